@@ -0,0 +1,74 @@
+#include "Benchmark.hpp"
+
+#include "RayTracer/Arena.hpp"
+#include "RayTracer/Hit.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+namespace RayTracer::Benchmarks
+{
+    namespace
+    {
+        constexpr const char* Tags = "[Arena]";
+        constexpr std::size_t TilePixels = 32 * 32;
+        constexpr int TileCount = 64;
+
+        /**
+         * The allocation pattern of rendering one tile: a sample buffer, a hit list and a handful of small lists
+         * that grow while the tile is shaded. Single threaded, so this only shows the cost of the allocator itself,
+         * not the contention of many threads on malloc.
+         */
+        float RenderTile(auto makeVector)
+        {
+            auto samples = makeVector.template operator()<float>();
+            samples.resize(TilePixels * 3);
+            auto hits = makeVector.template operator()<Hit>();
+            hits.reserve(TilePixels);
+            for (std::size_t i = 0; i < TilePixels; ++i)
+            {
+                hits.push_back({});
+            }
+            float sum = 0.0f;
+            for (int list = 0; list < 16; ++list)
+            {
+                auto indices = makeVector.template operator()<std::uint32_t>();
+                for (std::uint32_t i = 0; i < 64; ++i)
+                {
+                    indices.push_back(i);
+                }
+                sum += static_cast<float>(indices.back());
+            }
+            return sum + samples[0] + hits[0].t;
+        }
+    }
+
+    TEST_CASE("Arena", Tags)
+    {
+        SetOperations("Tile scratch (std::vector)", TileCount);
+        BENCHMARK("Tile scratch (std::vector)")
+        {
+            float sum = 0.0f;
+            for (int tile = 0; tile < TileCount; ++tile)
+            {
+                sum += RenderTile([]<typename T>() { return std::vector<T>{}; });
+            }
+            return sum;
+        };
+
+        Arena arena;
+        SetOperations("Tile scratch (Arena)", TileCount);
+        BENCHMARK("Tile scratch (Arena)")
+        {
+            float sum = 0.0f;
+            for (int tile = 0; tile < TileCount; ++tile)
+            {
+                sum += RenderTile([&]<typename T>() { return ScratchVector<T>{&arena}; });
+                arena.Reset();
+            }
+            return sum;
+        };
+    }
+}
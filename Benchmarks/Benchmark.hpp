@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace RayTracer::Benchmarks
+{
+    /**
+     * Fraction of generated sphere rays that hit their sphere, set with --hit-ratio.
+     */
+    float HitRatio();
+
+    /**
+     * Records how many operations one run of the named benchmark performs, so results can be reported per operation.
+     * When rays is true, the operations are rays and the result is also reported in Mrays/s.
+     */
+    void SetOperations(const std::string& benchmark, std::uint64_t operations, bool rays = false);
+
+    /**
+     * A fixed seed generator, so every run measures the same inputs.
+     */
+    inline std::mt19937 MakeGenerator()
+    {
+        return std::mt19937{0x5EED};
+    }
+}
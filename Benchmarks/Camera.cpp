@@ -0,0 +1,57 @@
+#include "Benchmark.hpp"
+
+#include "RayTracer/Camera.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+namespace RayTracer::Benchmarks
+{
+    namespace
+    {
+        constexpr const char* Tags = "[Camera]";
+        constexpr int TileSize = 32;
+        constexpr std::size_t TilePixels = TileSize * TileSize;
+    }
+
+    TEST_CASE("Camera", Tags)
+    {
+        const Camera camera{{0.0f, 1.0f, 8.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, 1.0f, 1920, 1080};
+        const Tile tile{640, 320, TileSize, TileSize};
+
+        std::vector<Ray> rays(TilePixels);
+        SetOperations("Camera::GenerateRay", TilePixels, true);
+        BENCHMARK("Camera::GenerateRay")
+        {
+            std::size_t i = 0;
+            for (int y = tile.y; y < tile.y + tile.height; ++y)
+            {
+                for (int x = tile.x; x < tile.x + tile.width; ++x)
+                {
+                    rays[i++] = camera.GenerateRay(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                }
+            }
+            return rays.data();
+        };
+
+        std::vector<float> x(TilePixels);
+        std::vector<float> y(TilePixels);
+        std::vector<float> z(TilePixels);
+        SetOperations("Camera::GenerateRays (SoA)", TilePixels, true);
+        BENCHMARK("Camera::GenerateRays (SoA)")
+        {
+            camera.GenerateRays(tile, {x, y, z});
+            return x.data();
+        };
+
+        std::vector<RayPacket8> packets(static_cast<std::size_t>(Camera::PacketCount(tile)));
+        SetOperations("Camera::GeneratePackets", TilePixels, true);
+        BENCHMARK("Camera::GeneratePackets")
+        {
+            camera.GeneratePackets(tile, packets);
+            return packets.data();
+        };
+    }
+}
@@ -0,0 +1,120 @@
+#include "Benchmark.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_session.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
+#include <catch2/reporters/catch_reporter_registrars.hpp>
+
+#include <cstdlib>
+#include <map>
+#include <print>
+#include <vector>
+
+namespace RayTracer::Benchmarks
+{
+    namespace
+    {
+        struct Operations
+        {
+            std::uint64_t count = 1;
+            bool rays = false;
+        };
+
+        float hitRatio = 0.5f;
+
+        std::map<std::string, Operations>& OperationsByName()
+        {
+            static std::map<std::string, Operations> operations;
+            return operations;
+        }
+
+        /**
+         * Collects the mean of every benchmark and prints it as ns/op, and as Mrays/s for ray benchmarks, once the run
+         * has finished so the summary is not interleaved with the reporter output.
+         */
+        class ThroughputListener : public Catch::EventListenerBase
+        {
+          public:
+            using Catch::EventListenerBase::EventListenerBase;
+
+            void benchmarkEnded(const Catch::BenchmarkStats<>& stats) override
+            {
+                Operations operations;
+                if (auto it = OperationsByName().find(stats.info.name); it != OperationsByName().end())
+                {
+                    operations = it->second;
+                }
+                results.push_back({stats.info.name, stats.mean.point.count() / static_cast<double>(operations.count),
+                                   operations.rays});
+            }
+
+            void testRunEnded(const Catch::TestRunStats&) override
+            {
+                if (results.empty())
+                {
+                    return;
+                }
+
+                std::println("\n{:<40} {:>12} {:>12}", "benchmark", "ns/op", "Mrays/s");
+                for (const Result& result : results)
+                {
+                    if (result.rays)
+                    {
+                        std::println("{:<40} {:>12.2f} {:>12.2f}", result.name, result.nanoseconds,
+                                     1e3 / result.nanoseconds);
+                    }
+                    else
+                    {
+                        std::println("{:<40} {:>12.2f} {:>12}", result.name, result.nanoseconds, "-");
+                    }
+                }
+            }
+
+          private:
+            struct Result
+            {
+                std::string name;
+                double nanoseconds;
+                bool rays;
+            };
+
+            std::vector<Result> results;
+        };
+
+        CATCH_REGISTER_LISTENER(ThroughputListener)
+    }
+
+    float HitRatio()
+    {
+        return hitRatio;
+    }
+
+    void SetOperations(const std::string& benchmark, std::uint64_t operations, bool rays)
+    {
+        OperationsByName()[benchmark] = {operations, rays};
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Catch::Session session;
+
+    using namespace Catch::Clara;
+    auto cli = session.cli() | Opt(RayTracer::Benchmarks::hitRatio, "ratio")["--hit-ratio"](
+                                   "fraction of sphere benchmark rays that hit, between 0 and 1 (default 0.5)");
+    session.cli(cli);
+
+    int result = session.applyCommandLine(argc, argv);
+    if (result != 0)
+    {
+        return result;
+    }
+
+    float hitRatio = RayTracer::Benchmarks::HitRatio();
+    if (!(hitRatio >= 0.0f && hitRatio <= 1.0f))
+    {
+        std::println(stderr, "--hit-ratio must be between 0 and 1, got {}", hitRatio);
+        return EXIT_FAILURE;
+    }
+    return session.run();
+}
@@ -0,0 +1,195 @@
+#include "Benchmark.hpp"
+
+#include "RayTracer/Matrix.hpp"
+#include "RayTracer/Transform.hpp"
+#include "RayTracer/Vector3.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <numbers>
+#include <vector>
+
+namespace RayTracer::Benchmarks
+{
+    namespace
+    {
+        constexpr const char* Tags = "[Math]";
+        constexpr std::size_t BatchSize = 1024;
+
+        /**
+         * Random translate, rotate and scale matrices, the kind every object and camera transform is built from.
+         */
+        std::vector<Matrix> RandomTransforms(std::size_t count)
+        {
+            std::mt19937 generator = MakeGenerator();
+            std::uniform_real_distribution<float> angle{0.0f, 2.0f * std::numbers::pi_v<float>};
+            std::uniform_real_distribution<float> offset{-100.0f, 100.0f};
+            std::uniform_real_distribution<float> scale{0.1f, 10.0f};
+
+            std::vector<Matrix> transforms;
+            transforms.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                Matrix transform = Matrix::Scaling({scale(generator), scale(generator), scale(generator)}) *
+                                   Matrix::RotationX(angle(generator)) * Matrix::RotationY(angle(generator)) *
+                                   Matrix::RotationZ(angle(generator)) *
+                                   Matrix::Translation({offset(generator), offset(generator), offset(generator)});
+                transforms.push_back(transform);
+            }
+            return transforms;
+        }
+
+        /**
+         * Vectors with random directions and lengths spread over several orders of magnitude.
+         */
+        std::vector<Vector3> RandomVectors(std::size_t count)
+        {
+            std::mt19937 generator = MakeGenerator();
+            std::normal_distribution<float> component{0.0f, 1.0f};
+            std::uniform_real_distribution<float> exponent{-3.0f, 3.0f};
+
+            std::vector<Vector3> vectors;
+            vectors.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                Vector3 direction = Vector3{component(generator), component(generator), component(generator)};
+                vectors.push_back(direction * std::powf(10.0f, exponent(generator)));
+            }
+            return vectors;
+        }
+    }
+
+    TEST_CASE("Matrix", Tags)
+    {
+        const std::vector<Matrix> transforms = RandomTransforms(BatchSize);
+        std::vector<Matrix> results(BatchSize);
+
+        SetOperations("Matrix::operator*", BatchSize);
+        BENCHMARK("Matrix::operator*")
+        {
+            for (std::size_t i = 0; i < BatchSize; ++i)
+            {
+                results[i] = transforms[i] * transforms[(i + 1) % BatchSize];
+            }
+            return results.data();
+        };
+
+        std::vector<Vector4> points(BatchSize);
+        for (std::size_t i = 0; i < BatchSize; ++i)
+        {
+            points[i] = Vector4{transforms[i](0, 3), transforms[i](1, 3), transforms[i](2, 3), 1.0f};
+        }
+        std::vector<Vector4> transformed(BatchSize);
+
+        SetOperations("Matrix::operator* (Vector4)", BatchSize);
+        BENCHMARK("Matrix::operator* (Vector4)")
+        {
+            for (std::size_t i = 0; i < BatchSize; ++i)
+            {
+                transformed[i] = transforms[i] * points[(i + 1) % BatchSize];
+            }
+            return transformed.data();
+        };
+
+        SetOperations("Matrix::Inverse", BatchSize);
+        BENCHMARK("Matrix::Inverse")
+        {
+            for (std::size_t i = 0; i < BatchSize; ++i)
+            {
+                results[i] = transforms[i].Inverse();
+            }
+            return results.data();
+        };
+    }
+
+    TEST_CASE("Matrix batch transforms", Tags)
+    {
+        constexpr std::size_t PointCount = 1 << 16;
+        const Matrix transform = RandomTransforms(1).front();
+        const std::vector<Vector3> points = RandomVectors(PointCount);
+        std::vector<Vector3> transformed(PointCount);
+
+        SetOperations("Matrix::operator* (per point)", PointCount);
+        BENCHMARK("Matrix::operator* (per point)")
+        {
+            for (std::size_t i = 0; i < PointCount; ++i)
+            {
+                Vector4 point = transform * Vector4{points[i], 1.0f};
+                transformed[i] = {point.x, point.y, point.z};
+            }
+            return transformed.data();
+        };
+
+        SetOperations("Matrix::TransformPoints", PointCount);
+        BENCHMARK("Matrix::TransformPoints")
+        {
+            transform.TransformPoints(points, transformed);
+            return transformed.data();
+        };
+
+        std::vector<float> x(PointCount), y(PointCount), z(PointCount);
+        std::vector<float> outX(PointCount), outY(PointCount), outZ(PointCount);
+        for (std::size_t i = 0; i < PointCount; ++i)
+        {
+            x[i] = points[i].x;
+            y[i] = points[i].y;
+            z[i] = points[i].z;
+        }
+        SetOperations("Matrix::TransformPoints (SoA)", PointCount);
+        BENCHMARK("Matrix::TransformPoints (SoA)")
+        {
+            transform.TransformPoints(ConstVector3Arrays{x, y, z}, Vector3Arrays{outX, outY, outZ});
+            return outX.data();
+        };
+    }
+
+    TEST_CASE("Transform", Tags)
+    {
+        std::vector<Transform> transforms;
+        transforms.reserve(BatchSize);
+        for (const Matrix& matrix : RandomTransforms(BatchSize))
+        {
+            transforms.emplace_back(matrix);
+        }
+        const std::vector<Vector3> points = RandomVectors(BatchSize);
+        std::vector<Transform> composed(BatchSize);
+        std::vector<Vector3> transformed(BatchSize);
+
+        SetOperations("Transform::operator*", BatchSize);
+        BENCHMARK("Transform::operator*")
+        {
+            for (std::size_t i = 0; i < BatchSize; ++i)
+            {
+                composed[i] = transforms[i] * transforms[(i + 1) % BatchSize];
+            }
+            return composed.data();
+        };
+
+        SetOperations("Transform::TransformPoint", BatchSize);
+        BENCHMARK("Transform::TransformPoint")
+        {
+            for (std::size_t i = 0; i < BatchSize; ++i)
+            {
+                transformed[i] = transforms[i].TransformPoint(points[i]);
+            }
+            return transformed.data();
+        };
+    }
+
+    TEST_CASE("Vector3", Tags)
+    {
+        const std::vector<Vector3> vectors = RandomVectors(BatchSize);
+        std::vector<Vector3> results(BatchSize);
+
+        SetOperations("Vector3::Normalized", BatchSize);
+        BENCHMARK("Vector3::Normalized")
+        {
+            for (std::size_t i = 0; i < BatchSize; ++i)
+            {
+                results[i] = vectors[i].Normalized();
+            }
+            return results.data();
+        };
+    }
+}
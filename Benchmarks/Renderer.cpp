@@ -0,0 +1,77 @@
+#include "Benchmark.hpp"
+
+#include "RayTracer/Bvh.hpp"
+#include "RayTracer/Camera.hpp"
+#include "RayTracer/Framebuffer.hpp"
+#include "RayTracer/Renderer.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+
+namespace RayTracer::Benchmarks
+{
+    namespace
+    {
+        constexpr const char* Tags = "[Renderer]";
+        constexpr int Width = 512;
+        constexpr int Height = 512;
+        constexpr int SphereCount = 200000;
+
+        /**
+         * A cloud of small spheres large enough that its BVH does not fit in the caches, so the order of the rays
+         * decides how often nodes are fetched from memory.
+         */
+        std::vector<Sphere> GenerateScene()
+        {
+            std::mt19937 generator = MakeGenerator();
+            std::uniform_real_distribution<float> position{-50.0f, 50.0f};
+            std::uniform_real_distribution<float> radius{0.05f, 0.4f};
+            std::vector<Sphere> spheres;
+            spheres.reserve(SphereCount);
+            for (int i = 0; i < SphereCount; ++i)
+            {
+                spheres.push_back({{position(generator), position(generator), position(generator)}, radius(generator)});
+            }
+            return spheres;
+        }
+
+        const char* Name(PixelOrder order)
+        {
+            return order == PixelOrder::Morton ? "Morton" : "scanline";
+        }
+    }
+
+    TEST_CASE("Renderer", Tags)
+    {
+        const std::vector<Sphere> spheres = GenerateScene();
+        const Bvh bvh{spheres};
+        const Camera camera{{0.0f, 0.0f, 120.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, 0.9f, Width, Height};
+        Framebuffer framebuffer{Width, Height};
+        ThreadPool pool;
+
+        for (PixelOrder tileOrder : {PixelOrder::Scanline, PixelOrder::Morton})
+        {
+            for (PixelOrder pixelOrder : {PixelOrder::Scanline, PixelOrder::Morton})
+            {
+                Renderer renderer{pool, Renderer::DefaultTileSize, tileOrder};
+                auto renderTile = [&](const Tile& tile, unsigned) {
+                    ForEachPixel(tile, pixelOrder, [&](int x, int y) {
+                        Ray ray = camera.GenerateRay(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                        Hit hit = bvh.ClosestHit(ray);
+                        framebuffer.At(x, y) = hit.hit ? Color{hit.t, hit.t, hit.t} : Color{0.0f, 0.0f, 0.0f};
+                    });
+                };
+
+                std::string name = std::string{"Render "} + Name(tileOrder) + " tiles, " + Name(pixelOrder) + " pixels";
+                SetOperations(name, static_cast<std::uint64_t>(Width) * Height, true);
+                BENCHMARK(name.c_str())
+                {
+                    return renderer.Render(Width, Height, renderTile).wall.count();
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#include "Benchmark.hpp"
+
+#include "RayTracer/Ray.hpp"
+#include "RayTracer/Sphere.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+namespace RayTracer::Benchmarks
+{
+    namespace
+    {
+        constexpr const char* Tags = "[Sphere]";
+        constexpr std::size_t BatchSize = 4096;
+
+        struct SphereRays
+        {
+            std::vector<Sphere> spheres;
+            std::vector<Ray> rays;
+        };
+
+        /**
+         * Pairs of spheres and rays where HitRatio() of the rays hit their sphere. Origins lie on a shell around the
+         * sphere and directions are random, so hits and misses come from the same distribution and are not
+         * separable by the branch predictor.
+         */
+        SphereRays GenerateSphereRays(std::size_t count)
+        {
+            std::mt19937 generator = MakeGenerator();
+            std::uniform_real_distribution<float> position{-50.0f, 50.0f};
+            std::uniform_real_distribution<float> radius{0.5f, 5.0f};
+            std::uniform_real_distribution<float> distance{2.0f, 8.0f};
+            std::uniform_real_distribution<float> unit{0.0f, 1.0f};
+            std::normal_distribution<float> component{0.0f, 1.0f};
+            auto randomDirection = [&]() {
+                return Vector3{component(generator), component(generator), component(generator)}.Normalized();
+            };
+
+            SphereRays result;
+            result.spheres.reserve(count);
+            result.rays.reserve(count);
+            const float hitRatio = HitRatio();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                Sphere sphere{{position(generator), position(generator), position(generator)}, radius(generator)};
+                Vector3 origin = sphere.center + randomDirection() * (sphere.radius * distance(generator));
+                const bool wantHit = unit(generator) < hitRatio;
+
+                // Rejection sampling keeps the direction distribution the same for hits and misses.
+                Ray ray;
+                do
+                {
+                    ray = Ray{origin, randomDirection()};
+                } while (sphere.Intersect(ray).hit != wantHit);
+
+                result.spheres.push_back(sphere);
+                result.rays.push_back(ray);
+            }
+            return result;
+        }
+    }
+
+    TEST_CASE("Sphere", Tags)
+    {
+        const SphereRays input = GenerateSphereRays(BatchSize);
+        std::vector<Sphere::RayIntersection> results(BatchSize);
+
+        SetOperations("Sphere::Intersect", BatchSize, true);
+        BENCHMARK("Sphere::Intersect")
+        {
+            for (std::size_t i = 0; i < BatchSize; ++i)
+            {
+                results[i] = input.spheres[i].Intersect(input.rays[i]);
+            }
+            return results.data();
+        };
+
+        std::vector<Hit> hits(BatchSize);
+        SetOperations("Sphere::Intersect (interval, Hit)", BatchSize, true);
+        BENCHMARK("Sphere::Intersect (interval, Hit)")
+        {
+            for (std::size_t i = 0; i < BatchSize; ++i)
+            {
+                hits[i] = input.spheres[i].Intersect(input.rays[i], 0.0f, 100.0f);
+            }
+            return hits.data();
+        };
+
+        std::vector<char> occluded(BatchSize);
+        SetOperations("Sphere::Occluded", BatchSize, true);
+        BENCHMARK("Sphere::Occluded")
+        {
+            for (std::size_t i = 0; i < BatchSize; ++i)
+            {
+                occluded[i] = input.spheres[i].Occluded(input.rays[i], 100.0f);
+            }
+            return occluded.data();
+        };
+    }
+}
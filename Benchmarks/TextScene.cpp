@@ -0,0 +1,77 @@
+#include "Benchmark.hpp"
+
+#include "RayTracer/TextScene.hpp"
+#include "RayTracer/ThreadPool.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace RayTracer::Benchmarks
+{
+    namespace
+    {
+        constexpr const char* Tags = "[TextScene]";
+        constexpr std::size_t SphereCount = 500000;
+
+        std::string GenerateText()
+        {
+            std::mt19937 generator = MakeGenerator();
+            std::uniform_real_distribution<float> position{-1000.0f, 1000.0f};
+            std::uniform_real_distribution<float> radius{0.01f, 10.0f};
+            SphereSoA spheres;
+            spheres.Reserve(SphereCount);
+            for (std::size_t i = 0; i < SphereCount; ++i)
+            {
+                spheres.Add({{position(generator), position(generator), position(generator)}, radius(generator)});
+            }
+            std::ostringstream stream;
+            TextScene::Write(stream, spheres.View(), {});
+            return stream.str();
+        }
+
+        /**
+         * The straightforward iostream parser, as a baseline.
+         */
+        std::vector<Sphere> ParseWithStream(const std::string& text)
+        {
+            std::istringstream stream{text};
+            std::vector<Sphere> spheres;
+            std::string keyword;
+            Sphere sphere;
+            while (stream >> keyword >> sphere.center.x >> sphere.center.y >> sphere.center.z >> sphere.radius)
+            {
+                spheres.push_back(sphere);
+            }
+            return spheres;
+        }
+    }
+
+    TEST_CASE("TextScene", Tags)
+    {
+        const std::string text = GenerateText();
+
+        SetOperations("Scene text (iostream)", SphereCount);
+        BENCHMARK("Scene text (iostream)")
+        {
+            return ParseWithStream(text).size();
+        };
+
+        ThreadPool single{1};
+        SetOperations("TextScene::Parse (1 thread)", SphereCount);
+        BENCHMARK("TextScene::Parse (1 thread)")
+        {
+            return TextScene::Parse(text, single)->spheres.Size();
+        };
+
+        ThreadPool pool;
+        SetOperations("TextScene::Parse (all threads)", SphereCount);
+        BENCHMARK("TextScene::Parse (all threads)")
+        {
+            return TextScene::Parse(text, pool)->spheres.Size();
+        };
+    }
+}
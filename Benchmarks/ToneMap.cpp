@@ -0,0 +1,106 @@
+#include "Benchmark.hpp"
+
+#include "RayTracer/Framebuffer.hpp"
+#include "RayTracer/ToneMap.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace RayTracer::Benchmarks
+{
+    namespace
+    {
+        constexpr const char* Tags = "[ToneMap]";
+        // A 4K preview, the largest image pushed out on every progressive update.
+        constexpr int Width = 3840;
+        constexpr int Height = 2160;
+
+        /**
+         * Colors with an exponential spread of intensities, so that a share of them lands above 1 and is compressed
+         * by the tone mapping operators.
+         */
+        Framebuffer RandomFramebuffer()
+        {
+            std::mt19937 generator = MakeGenerator();
+            std::uniform_real_distribution<float> exponent{-6.0f, 2.0f};
+            Framebuffer framebuffer{Width, Height};
+            for (int y = 0; y < Height; ++y)
+            {
+                for (Color& color : framebuffer.Row(y))
+                {
+                    color = {std::exp2(exponent(generator)), std::exp2(exponent(generator)),
+                             std::exp2(exponent(generator))};
+                }
+            }
+            return framebuffer;
+        }
+
+        /**
+         * The conversion written naively, with std::pow per channel, for comparison.
+         */
+        std::uint8_t NaiveByte(float value)
+        {
+            float srgb = ToneMapper::LinearToSrgb(std::clamp(value, 0.0f, 1.0f));
+            return static_cast<std::uint8_t>(srgb * 255.0f + 0.5f);
+        }
+
+        const char* Name(ToneMapOperator toneMap)
+        {
+            if (toneMap == ToneMapOperator::Reinhard)
+            {
+                return "Reinhard";
+            }
+            return toneMap == ToneMapOperator::Aces ? "ACES" : "clamp";
+        }
+    }
+
+    TEST_CASE("ToneMap", Tags)
+    {
+        const Framebuffer framebuffer = RandomFramebuffer();
+        Rgba8Image image{Width, Height};
+        ThreadPool pool;
+        constexpr std::uint64_t Pixels = static_cast<std::uint64_t>(Width) * Height;
+
+        SetOperations("std::pow, 1 thread", Pixels);
+        BENCHMARK("std::pow, 1 thread")
+        {
+            for (int y = 0; y < Height; ++y)
+            {
+                std::span<const Color> in = framebuffer.Row(y);
+                std::span<std::uint32_t> out = image.Row(y);
+                for (int x = 0; x < Width; ++x)
+                {
+                    out[x] = PackRgba8(NaiveByte(in[x].r), NaiveByte(in[x].g), NaiveByte(in[x].b));
+                }
+            }
+            return image.Row(0).data();
+        };
+
+        const ToneMapper clamp;
+        SetOperations("ToneMapper::ConvertRow, clamp, 1 thread", Pixels);
+        BENCHMARK("ToneMapper::ConvertRow, clamp, 1 thread")
+        {
+            for (int y = 0; y < Height; ++y)
+            {
+                clamp.ConvertRow(framebuffer.Row(y), image.Row(y));
+            }
+            return image.Row(0).data();
+        };
+
+        for (ToneMapOperator toneMap : {ToneMapOperator::Clamp, ToneMapOperator::Reinhard, ToneMapOperator::Aces})
+        {
+            const ToneMapper toneMapper{{1.0f, toneMap}};
+            std::string name = std::string{"ToneMapper::Convert, "} + Name(toneMap);
+            SetOperations(name, Pixels);
+            BENCHMARK(name.c_str())
+            {
+                toneMapper.Convert(pool, framebuffer, image);
+                return image.Row(0).data();
+            };
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#include "Benchmark.hpp"
+
+#include "RayTracer/Bvh.hpp"
+#include "RayTracer/Camera.hpp"
+#include "RayTracer/Framebuffer.hpp"
+#include "RayTracer/Renderer.hpp"
+#include "RayTracer/Wavefront.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+
+namespace RayTracer::Benchmarks
+{
+    namespace
+    {
+        constexpr const char* Tags = "[Wavefront]";
+        constexpr int Width = 256;
+        constexpr int Height = 256;
+        constexpr int SphereCount = 2000;
+
+        /**
+         * Spheres resting on a large ground sphere, so that most paths survive several bounces.
+         */
+        std::vector<Sphere> GenerateScene()
+        {
+            std::mt19937 generator = MakeGenerator();
+            std::uniform_real_distribution<float> position{-20.0f, 20.0f};
+            std::uniform_real_distribution<float> radius{0.2f, 1.0f};
+            std::vector<Sphere> spheres;
+            spheres.reserve(SphereCount + 1);
+            spheres.push_back({{0.0f, -1000.0f, 0.0f}, 1000.0f});
+            for (int i = 0; i < SphereCount; ++i)
+            {
+                float r = radius(generator);
+                spheres.push_back({{position(generator), r, position(generator)}, r});
+            }
+            return spheres;
+        }
+    }
+
+    TEST_CASE("Wavefront", Tags)
+    {
+        const std::vector<Sphere> spheres = GenerateScene();
+        const Bvh bvh{spheres};
+        const Camera camera{{0.0f, 6.0f, 30.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, 0.9f, Width, Height};
+        Framebuffer framebuffer{Width, Height};
+        ThreadPool pool;
+        Renderer renderer{pool};
+
+        struct Variant
+        {
+            int maxDepth;
+            bool sortRays;
+        };
+        for (Variant variant : {Variant{1, false}, Variant{4, false}, Variant{4, true}})
+        {
+            WavefrontIntegrator::Settings settings;
+            settings.samplesPerPixel = 1;
+            settings.maxDepth = variant.maxDepth;
+            settings.sortRays = variant.sortRays;
+            settings.lights = {Light::Directional({0.5f, 1.0f, 0.3f}, {2.0f, 1.9f, 1.7f})};
+            const WavefrontIntegrator integrator{camera, settings};
+            auto renderTile = [&](const Tile& tile, unsigned worker) {
+                integrator.RenderTile(bvh, tile, renderer.Scratch(worker), framebuffer);
+            };
+
+            std::string name = "WavefrontIntegrator, depth " + std::to_string(variant.maxDepth) +
+                               (variant.sortRays ? ", sorted" : "");
+            SetOperations(name, static_cast<std::uint64_t>(Width) * Height, false);
+            BENCHMARK(name.c_str())
+            {
+                return renderer.Render(Width, Height, renderTile).wall.count();
+            };
+        }
+    }
+}
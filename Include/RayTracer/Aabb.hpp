@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace RayTracer
+{
+    /**
+     * An axis aligned bounding box. A default constructed box is empty, so expanding it by any point or box yields
+     * that point or box.
+     */
+    struct Aabb
+    {
+        Vector3 min;
+        Vector3 max;
+
+        constexpr Aabb() noexcept
+            : min{std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+                  std::numeric_limits<float>::infinity()}
+            , max{-std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                  -std::numeric_limits<float>::infinity()}
+        {
+        }
+
+        constexpr Aabb(const Vector3& min, const Vector3& max) noexcept
+            : min{min}
+            , max{max}
+        {
+        }
+
+        bool IsEmpty() const
+        {
+            return min.x > max.x || min.y > max.y || min.z > max.z;
+        }
+
+        void Expand(const Vector3& point)
+        {
+            min = {std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z)};
+            max = {std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z)};
+        }
+
+        void Expand(const Aabb& other)
+        {
+            min = {std::min(min.x, other.min.x), std::min(min.y, other.min.y), std::min(min.z, other.min.z)};
+            max = {std::max(max.x, other.max.x), std::max(max.y, other.max.y), std::max(max.z, other.max.z)};
+        }
+
+        static Aabb Union(const Aabb& a, const Aabb& b)
+        {
+            Aabb result = a;
+            result.Expand(b);
+            return result;
+        }
+
+        Vector3 Centroid() const
+        {
+            return (min + max) * 0.5f;
+        }
+
+        Vector3 Extent() const
+        {
+            return max - min;
+        }
+
+        float SurfaceArea() const
+        {
+            if (IsEmpty())
+            {
+                return 0.0f;
+            }
+            Vector3 e = Extent();
+            return 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+        }
+
+        int LongestAxis() const
+        {
+            Vector3 e = Extent();
+            if (e.x > e.y && e.x > e.z)
+            {
+                return 0;
+            }
+            return e.y > e.z ? 1 : 2;
+        }
+
+        /**
+         * Slab test against a ray given by its origin and precomputed inverse direction. On a hit, tEntry is set to
+         * the distance at which the ray enters the box, clamped to tMin.
+         */
+        bool Intersect(const Vector3& origin, const Vector3& inverseDirection, float tMin, float tMax,
+                       float& tEntry) const
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                float t0 = (min[axis] - origin[axis]) * inverseDirection[axis];
+                float t1 = (max[axis] - origin[axis]) * inverseDirection[axis];
+                if (t0 > t1)
+                {
+                    std::swap(t0, t1);
+                }
+                tMin = t0 > tMin ? t0 : tMin;
+                tMax = t1 < tMax ? t1 : tMax;
+                if (tMax < tMin)
+                {
+                    return false;
+                }
+            }
+            tEntry = tMin;
+            return true;
+        }
+    };
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Hit.hpp"
+#include "Ray.hpp"
+#include "RayPacket.hpp"
+#include "TraversalRay.hpp"
+
+#include <concepts>
+#include <span>
+
+namespace RayTracer
+{
+    /**
+     * The interface shared by all sphere acceleration structures, so that renderers can be written against any of
+     * them. ClosestHit takes either a plain ray or a TraversalRay prepared by the caller. Occluded is the any-hit
+     * query for shadow rays.
+     */
+    template <typename T>
+    concept Accelerator = requires(const T& accelerator, const Ray& ray, const TraversalRay& traversalRay) {
+        { accelerator.ClosestHit(ray) } -> std::same_as<Hit>;
+        { accelerator.ClosestHit(traversalRay) } -> std::same_as<Hit>;
+        { accelerator.Occluded(traversalRay) } -> std::same_as<bool>;
+        { accelerator.Occluded(ray, 1.0f) } -> std::same_as<bool>;
+    };
+
+    /**
+     * An Accelerator that can also trace eight rays per traversal. ClosestHit fills one Hit per lane of the packet and
+     * Occluded returns a bit mask of the occluded lanes. Inactive lanes report no hit and are never occluded.
+     */
+    template <typename T>
+    concept PacketAccelerator =
+        Accelerator<T> &&
+        requires(const T& accelerator, const TraversalPacket8& packet, std::span<Hit, RayPacket8::Size> hits) {
+            { accelerator.ClosestHit(packet, hits) } -> std::same_as<void>;
+            { accelerator.Occluded(packet) } -> std::same_as<int>;
+        };
+}
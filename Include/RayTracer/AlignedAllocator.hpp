@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace RayTracer
+{
+    /**
+     * A standard allocator that aligns every allocation to Alignment bytes, for containers whose storage is read
+     * with aligned SIMD loads.
+     */
+    template <typename T, std::size_t Alignment>
+    struct AlignedAllocator
+    {
+        static_assert(Alignment >= alignof(T), "Alignment must not be smaller than the natural alignment of T");
+
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        constexpr AlignedAllocator() noexcept = default;
+
+        template <typename U>
+        constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+        }
+
+        void deallocate(T* pointer, std::size_t count) noexcept
+        {
+            ::operator delete(pointer, count * sizeof(T), std::align_val_t{Alignment});
+        }
+
+        template <typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+        {
+            return true;
+        }
+    };
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * A bump allocator for short lived scratch data. Allocation advances a pointer through large blocks taken from
+     * the upstream resource, deallocation does nothing, and Reset releases everything at once. An arena is not thread
+     * safe, the intent is one per worker thread that is reset after every tile.
+     */
+    class Arena : public std::pmr::memory_resource
+    {
+      public:
+        static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+        explicit Arena(std::size_t blockSize = DefaultBlockSize,
+                       std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+        ~Arena() override;
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        /**
+         * Makes all memory available again. Anything allocated before must no longer be used. If the last round
+         * needed more than one block, they are merged into a single block of the combined size, so an arena settles
+         * on one block that fits the largest round.
+         */
+        void Reset();
+
+        /**
+         * Bytes handed out since the last Reset, including alignment padding.
+         */
+        std::size_t BytesUsed() const;
+
+        /**
+         * Total size of the blocks held by the arena.
+         */
+        std::size_t Capacity() const;
+
+      private:
+        struct Block
+        {
+            std::byte* data;
+            std::size_t size;
+        };
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+        void do_deallocate(void*, std::size_t, std::size_t) override
+        {
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        void AddBlock(std::size_t minimumSize);
+
+        void ReleaseBlocks();
+
+        std::pmr::memory_resource* upstream;
+        std::size_t blockSize;
+        std::vector<Block> blocks;
+        // Bump position in the last block, and the bytes used in all blocks before it.
+        std::size_t offset = 0;
+        std::size_t usedInPreviousBlocks = 0;
+    };
+
+    /**
+     * A vector for per-tile scratch data, e.g. allocated from the Arena of the current worker.
+     */
+    template <typename T>
+    using ScratchVector = std::pmr::vector<T>;
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "Aabb.hpp"
+#include "Hit.hpp"
+#include "Ray.hpp"
+#include "Sphere.hpp"
+#include "TraversalRay.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * A node of a flattened binary BVH, laid out in depth-first order so that the first child of an interior node
+     * always directly follows it. Bounds are stored as plain floats to keep a node at 32 bytes.
+     */
+    struct BvhNode
+    {
+        float boundsMin[3];
+        float boundsMax[3];
+        // Leaf: index of the first primitive. Interior: index of the second child.
+        std::uint32_t offset;
+        // Number of primitives in a leaf, zero for interior nodes.
+        std::uint16_t count;
+        // Split axis of interior nodes, used to visit the nearer child first.
+        std::uint16_t axis;
+
+        bool IsLeaf() const
+        {
+            return count > 0;
+        }
+
+        Aabb Bounds() const
+        {
+            return {{boundsMin[0], boundsMin[1], boundsMin[2]}, {boundsMax[0], boundsMax[1], boundsMax[2]}};
+        }
+
+        /**
+         * Slab test against the ray interval clipped to tMax. Writes the entry distance to tEntry.
+         */
+        bool Intersect(const TraversalRay& ray, float tMax, float& tEntry) const
+        {
+            // The sign picks the entry and exit plane of every slab, so no swap or min/max is needed per axis.
+            const float* bounds[2] = {boundsMin, boundsMax};
+            float tMin = ray.tMin;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                float t0 = (bounds[ray.sign[axis]][axis] - ray.ray.origin[axis]) * ray.inverseDirection[axis];
+                float t1 = (bounds[1 - ray.sign[axis]][axis] - ray.ray.origin[axis]) * ray.inverseDirection[axis];
+                tMin = t0 > tMin ? t0 : tMin;
+                tMax = t1 < tMax ? t1 : tMax;
+            }
+            tEntry = tMin;
+            return tMin <= tMax;
+        }
+    };
+
+    static_assert(sizeof(BvhNode) == 32);
+
+    /**
+     * Non-owning traversal of a flattened BVH over spheres, e.g. one built by Bvh or loaded in place from a
+     * SceneSnapshot. The spheres are stored in leaf order and primitiveIndices maps them back to their original
+     * indices.
+     */
+    class BvhView
+    {
+      public:
+        // Depth limit of the trees built by Bvh, which bounds the traversal stack.
+        static constexpr int MaxDepth = 64;
+
+        BvhView() = default;
+
+        BvhView(std::span<const BvhNode> nodes, std::span<const std::uint32_t> primitiveIndices,
+                std::span<const Sphere> spheres)
+            : nodes{nodes}
+            , primitiveIndices{primitiveIndices}
+            , spheres{spheres}
+        {
+        }
+
+        /**
+         * Finds the closest sphere hit by the ray. Hit::primitive is the original index of the sphere.
+         */
+        Hit ClosestHit(const Ray& ray) const
+        {
+            return ClosestHit(TraversalRay{ray});
+        }
+
+        Hit ClosestHit(const TraversalRay& ray) const;
+
+        /**
+         * Whether any sphere is hit inside the ray interval. Traversal stops at the first hit found, in any order.
+         */
+        bool Occluded(const TraversalRay& ray) const;
+
+        bool Occluded(const Ray& ray, float tMax) const
+        {
+            return Occluded(TraversalRay{ray, 0.0f, tMax});
+        }
+
+        /**
+         * Packet versions of the queries above, which traverse the tree once for all eight rays. A node is visited
+         * while any active lane may still hit inside it, and its leaf spheres are intersected with the whole packet.
+         * Without AVX2 the lanes are traced one at a time.
+         */
+        void ClosestHit(const TraversalPacket8& packet, std::span<Hit, RayPacket8::Size> hits) const;
+
+        /**
+         * Returns a bit mask of the occluded lanes.
+         */
+        int Occluded(const TraversalPacket8& packet) const;
+
+        /**
+         * Bounds of all spheres, empty when there are none.
+         */
+        Aabb Bounds() const
+        {
+            return nodes.empty() ? Aabb{} : nodes[0].Bounds();
+        }
+
+        std::span<const BvhNode> Nodes() const
+        {
+            return nodes;
+        }
+
+        std::span<const std::uint32_t> PrimitiveIndices() const
+        {
+            return primitiveIndices;
+        }
+
+        std::span<const Sphere> Spheres() const
+        {
+            return spheres;
+        }
+
+      private:
+        std::span<const BvhNode> nodes;
+        std::span<const std::uint32_t> primitiveIndices;
+        std::span<const Sphere> spheres;
+    };
+
+    /**
+     * A bounding volume hierarchy over spheres, built with a binned surface area heuristic. The spheres are copied in
+     * leaf order so that each leaf references a contiguous range.
+     */
+    class Bvh
+    {
+      public:
+        static constexpr int BinCount = 16;
+        static constexpr int MaxLeafSize = 4;
+        static constexpr int MaxDepth = BvhView::MaxDepth;
+
+        Bvh() = default;
+
+        explicit Bvh(std::span<const Sphere> spheres);
+
+        /**
+         * Builds the node array for arbitrary primitive bounds. primitiveIndices receives the primitive order that the
+         * leaves index into.
+         */
+        static std::vector<BvhNode> Build(std::span<const Aabb> primitiveBounds,
+                                          std::vector<std::uint32_t>& primitiveIndices);
+
+        /**
+         * Finds the closest sphere hit by the ray. Hit::primitive is the index of the sphere in the span passed to the
+         * constructor.
+         */
+        Hit ClosestHit(const Ray& ray) const
+        {
+            return View().ClosestHit(ray);
+        }
+
+        Hit ClosestHit(const TraversalRay& ray) const
+        {
+            return View().ClosestHit(ray);
+        }
+
+        /**
+         * Whether any sphere is hit inside the ray interval. Traversal stops at the first hit found, in any order.
+         */
+        bool Occluded(const TraversalRay& ray) const
+        {
+            return View().Occluded(ray);
+        }
+
+        bool Occluded(const Ray& ray, float tMax) const
+        {
+            return View().Occluded(ray, tMax);
+        }
+
+        void ClosestHit(const TraversalPacket8& packet, std::span<Hit, RayPacket8::Size> hits) const
+        {
+            View().ClosestHit(packet, hits);
+        }
+
+        int Occluded(const TraversalPacket8& packet) const
+        {
+            return View().Occluded(packet);
+        }
+
+        /**
+         * Bounds of all spheres, empty when there are none.
+         */
+        Aabb Bounds() const
+        {
+            return View().Bounds();
+        }
+
+        BvhView View() const
+        {
+            return {nodes, primitiveIndices, spheres};
+        }
+
+        std::span<const BvhNode> Nodes() const
+        {
+            return nodes;
+        }
+
+        std::span<const std::uint32_t> PrimitiveIndices() const
+        {
+            return primitiveIndices;
+        }
+
+        std::span<const Sphere> Spheres() const
+        {
+            return spheres;
+        }
+
+      private:
+        std::vector<BvhNode> nodes;
+        std::vector<std::uint32_t> primitiveIndices;
+        std::vector<Sphere> spheres;
+    };
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "Ray.hpp"
+#include "RayPacket.hpp"
+#include "Renderer.hpp"
+#include "Vector3.hpp"
+
+#include <span>
+
+namespace RayTracer
+{
+    /**
+     * A pinhole camera that turns pixel coordinates into primary rays. The inverse view-projection is computed once
+     * on construction. Because the direction through a pixel is an affine function of its coordinates, it is reduced
+     * to a direction for pixel (0, 0) plus one step per pixel in x and in y. Batch generation then only needs a
+     * multiply-add and a normalization per ray, done eight (AVX2) or four (SSE4) pixels at a time.
+     */
+    class Camera
+    {
+      public:
+        /**
+         * A camera at eye looking at target, with a vertical field of view in radians, for a width x height image.
+         */
+        Camera(const Vector3& eye, const Vector3& target, const Vector3& up, float verticalFov, int width, int height);
+
+        /**
+         * The ray through continuous pixel coordinates (x, y). Pixel centers are at half integers and y grows
+         * downwards.
+         */
+        Ray GenerateRay(float x, float y) const;
+
+        /**
+         * Writes the normalized directions of the rays through the pixel centers of tile, row by row, into SoA
+         * arrays that hold at least tile.width * tile.height entries. All rays start at Position().
+         */
+        void GenerateRays(const Tile& tile, const Vector3Arrays& directions) const;
+
+        /**
+         * Fills one packet per eight pixels of every tile row, PacketsPerRow(tile) packets per row. Lane i of packet
+         * p holds pixel (tile.x + (p % PacketsPerRow(tile)) * 8 + i, tile.y + p / PacketsPerRow(tile)). Lanes past
+         * the end of a row repeat its last pixel. packets must hold at least PacketCount(tile) entries.
+         */
+        void GeneratePackets(const Tile& tile, std::span<RayPacket8> packets) const;
+
+        static int PacketsPerRow(const Tile& tile)
+        {
+            return (tile.width + RayPacket8::Size - 1) / RayPacket8::Size;
+        }
+
+        static int PacketCount(const Tile& tile)
+        {
+            return PacketsPerRow(tile) * tile.height;
+        }
+
+        const Vector3& Position() const
+        {
+            return eye;
+        }
+
+        const Matrix& InverseViewProjection() const
+        {
+            return inverseViewProjection;
+        }
+
+        int Width() const
+        {
+            return width;
+        }
+
+        int Height() const
+        {
+            return height;
+        }
+
+      private:
+        /**
+         * Normalized directions of count pixels of row y starting at column x.
+         */
+        void GenerateRow(int x, int y, int count, float* directionX, float* directionY, float* directionZ) const;
+
+        Vector3 eye;
+        Matrix inverseViewProjection;
+        int width;
+        int height;
+        // Unnormalized direction through the top left image corner, pixel coordinates (0, 0), and its change per pixel.
+        Vector3 corner;
+        Vector3 stepX;
+        Vector3 stepY;
+    };
+}
@@ -1,15 +1,23 @@
 #pragma once
 
+#include "Simd.hpp"
+
 #include <cmath>
 #include <limits>
 
 namespace RayTracer
 {
-    struct Color
+    /**
+     * A linear RGB color. With the SIMD backend enabled it is padded to 16 bytes like Vector3.
+     */
+    struct alignas(Simd::VectorAlignment) Color
     {
         float r;
         float g;
         float b;
+#if defined(RAYTRACER_SIMD_SSE4)
+        float padding = 0.0f;
+#endif
 
         constexpr Color() noexcept
             : r{0}
@@ -25,6 +33,18 @@ namespace RayTracer
         {
         }
 
+#if defined(RAYTRACER_SIMD_SSE4)
+        explicit Color(__m128 v) noexcept
+        {
+            _mm_store_ps(&r, Simd::ClearW(v));
+        }
+
+        __m128 Load() const
+        {
+            return _mm_load_ps(&r);
+        }
+#endif
+
         bool operator==(const Color& other) const
         {
             constexpr float Epsilon = std::numeric_limits<float>::epsilon();
@@ -39,32 +59,56 @@ namespace RayTracer
 
         Color operator+(const Color& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Color{_mm_add_ps(Load(), other.Load())};
+#else
             return {r + other.r, g + other.g, b + other.b};
+#endif
         }
 
         Color operator-(const Color& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Color{_mm_sub_ps(Load(), other.Load())};
+#else
             return {r - other.r, g - other.g, b - other.b};
+#endif
         }
 
         Color operator-() const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Color{_mm_xor_ps(Load(), _mm_set1_ps(-0.0f))};
+#else
             return {-r, -g, -b};
+#endif
         }
 
         Color operator*(float scalar) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Color{_mm_mul_ps(Load(), _mm_set1_ps(scalar))};
+#else
             return {r * scalar, g * scalar, b * scalar};
+#endif
         }
 
         Color operator/(float scalar) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Color{_mm_div_ps(Load(), _mm_set1_ps(scalar))};
+#else
             return {r / scalar, g / scalar, b / scalar};
+#endif
         }
 
         Color operator*(const Color& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Color{_mm_mul_ps(Load(), other.Load())};
+#else
             return {r * other.r, g * other.g, b * other.b};
+#endif
         }
     };
 
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "AlignedAllocator.hpp"
+#include "Color.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * A width x height image of linear colors. Every row starts on a cache line boundary, so tiles rendered by
+     * different threads never share a cache line across rows.
+     */
+    class Framebuffer
+    {
+      public:
+        static constexpr std::size_t CacheLineSize = 64;
+
+        Framebuffer() = default;
+
+        Framebuffer(int width, int height);
+
+        int Width() const
+        {
+            return width;
+        }
+
+        int Height() const
+        {
+            return height;
+        }
+
+        /**
+         * Distance between the starts of two rows, in pixels.
+         */
+        std::size_t Stride() const
+        {
+            return stride;
+        }
+
+        Color& At(int x, int y)
+        {
+            return pixels[static_cast<std::size_t>(y) * stride + x];
+        }
+
+        const Color& At(int x, int y) const
+        {
+            return pixels[static_cast<std::size_t>(y) * stride + x];
+        }
+
+        std::span<Color> Row(int y)
+        {
+            return {pixels.data() + static_cast<std::size_t>(y) * stride, static_cast<std::size_t>(width)};
+        }
+
+        std::span<const Color> Row(int y) const
+        {
+            return {pixels.data() + static_cast<std::size_t>(y) * stride, static_cast<std::size_t>(width)};
+        }
+
+        void Clear(const Color& color = {});
+
+      private:
+        int width = 0;
+        int height = 0;
+        std::size_t stride = 0;
+        std::vector<Color, AlignedAllocator<Color, CacheLineSize>> pixels;
+    };
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Vector3.hpp"
+
+#include <cstdint>
+
+namespace RayTracer
+{
+    /**
+     * The closest intersection found by a scene query. primitive is the index of the sphere that was hit, and for
+     * instanced scenes instance is the index of the instance it belongs to. normal is unit length and always faces
+     * against the ray, and frontFace tells whether that is the outward side of the surface.
+     */
+    struct Hit
+    {
+        bool hit = false;
+        float t = 0.0f;
+        std::uint32_t primitive = 0;
+        std::uint32_t instance = 0;
+        Vector3 position;
+        Vector3 normal;
+        bool frontFace = false;
+    };
+}
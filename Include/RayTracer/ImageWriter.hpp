@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Framebuffer.hpp"
+#include "ToneMap.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <vector>
+
+namespace RayTracer
+{
+    enum class ImageFormat
+    {
+        // Binary PPM (P6), 8-bit sRGB converted by a ToneMapper.
+        Ppm,
+        // Portable float map, 32-bit linear floats per channel.
+        Pfm,
+    };
+
+    /**
+     * Streams a framebuffer to a PPM or PFM image, so rows can be written as soon as the tiles covering them finish
+     * instead of keeping a converted copy of the whole image. Rows may be reported in any order: a finished row is
+     * converted and written once all rows before it in file order are written too, so the stream never needs to seek.
+     * PFM stores rows bottom to top, so with top to bottom rendering its rows are only flushed at the end. Calls must
+     * not overlap.
+     */
+    class ImageWriter
+    {
+      public:
+        /**
+         * toneMap configures the conversion of PPM rows and is ignored for PFM, which stores the linear colors.
+         */
+        ImageWriter(std::ostream& stream, ImageFormat format, int width, int height,
+                    const ToneMapper::Settings& toneMap = {});
+
+        /**
+         * Marks rows [firstRow, firstRow + rowCount) of the framebuffer as finished and writes every row that is now
+         * next in file order.
+         */
+        void WriteRows(const Framebuffer& framebuffer, int firstRow, int rowCount);
+
+        /**
+         * True once every row has been written.
+         */
+        bool Complete() const
+        {
+            return nextFileRow == height;
+        }
+
+        /**
+         * Picks the format from a file extension, defaulting to PPM.
+         */
+        static ImageFormat FormatFromPath(const std::filesystem::path& path);
+
+      private:
+        void WriteRow(const Framebuffer& framebuffer, int row);
+
+        int ImageRow(int fileRow) const;
+
+        std::ostream& stream;
+        ImageFormat format;
+        int width;
+        int height;
+        std::vector<bool> rowFinished;
+        int nextFileRow = 0;
+        std::vector<char> rowBuffer;
+        ToneMapper toneMapper;
+        std::vector<std::uint32_t> encodedRow;
+    };
+}
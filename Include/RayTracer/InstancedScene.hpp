@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Aabb.hpp"
+#include "Bvh.hpp"
+#include "Hit.hpp"
+#include "Ray.hpp"
+#include "Transform.hpp"
+#include "TraversalRay.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * One placement of a shared geometry. The transform maps object space to world space and caches its inverse.
+     */
+    struct Instance
+    {
+        std::uint32_t geometry = 0;
+        Transform transform;
+    };
+
+    /**
+     * A two-level acceleration structure: every geometry is a Bvh over its spheres in object space (the bottom
+     * level), and a Bvh over the world space bounds of the instances sits on top. Rays are moved into the object
+     * space of every instance they reach, so any affine transform works, including non-uniform scaling that turns
+     * spheres into ellipsoids.
+     */
+    class InstancedScene
+    {
+      public:
+        InstancedScene() = default;
+
+        InstancedScene(std::vector<Bvh> geometries, std::vector<Instance> instances);
+
+        /**
+         * Finds the closest hit. Hit::instance is the index of the instance and Hit::primitive the index of the
+         * sphere in its geometry. Position and normal are in world space.
+         */
+        Hit ClosestHit(const Ray& ray) const
+        {
+            return ClosestHit(TraversalRay{ray});
+        }
+
+        Hit ClosestHit(const TraversalRay& ray) const;
+
+        bool Occluded(const TraversalRay& ray) const;
+
+        bool Occluded(const Ray& ray, float tMax) const
+        {
+            return Occluded(TraversalRay{ray, 0.0f, tMax});
+        }
+
+        std::span<const Bvh> Geometries() const
+        {
+            return geometries;
+        }
+
+        std::span<const Instance> Instances() const
+        {
+            return instances;
+        }
+
+        std::span<const BvhNode> Nodes() const
+        {
+            return nodes;
+        }
+
+      private:
+        std::vector<Bvh> geometries;
+        std::vector<Instance> instances;
+        // Top level tree over the instances. Leaves index into instanceIndices.
+        std::vector<BvhNode> nodes;
+        std::vector<std::uint32_t> instanceIndices;
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Color.hpp"
+#include "Vector3.hpp"
+
+namespace RayTracer
+{
+    enum class LightType
+    {
+        Point,
+        Directional,
+    };
+
+    /**
+     * A light that is sampled explicitly with shadow rays. A point light radiates color as intensity from position,
+     * falling off with the squared distance. A directional light is infinitely far away and delivers color as
+     * irradiance at normal incidence everywhere.
+     */
+    struct Light
+    {
+        LightType type = LightType::Directional;
+        // Position of a point light, or the unit direction towards a directional light.
+        Vector3 vector{0.0f, 1.0f, 0.0f};
+        Color color;
+
+        static Light Point(const Vector3& position, const Color& intensity)
+        {
+            return {LightType::Point, position, intensity};
+        }
+
+        static Light Directional(const Vector3& towardsLight, const Color& irradiance)
+        {
+            return {LightType::Directional, towardsLight.Normalized(), irradiance};
+        }
+    };
+}
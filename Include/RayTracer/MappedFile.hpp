@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <span>
+
+namespace RayTracer
+{
+    /**
+     * A whole file mapped read-only into memory, unmapped on destruction. Pages are read from disk on first access
+     * and shared with the page cache, so a mapping costs no copy and no memory beyond the pages in use. An empty file
+     * gives an empty mapping.
+     */
+    class MappedFile
+    {
+      public:
+        enum class Error
+        {
+            CannotOpen,
+            CannotMap,
+        };
+
+        MappedFile() = default;
+
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        static std::expected<MappedFile, Error> Open(const std::filesystem::path& path);
+
+        const std::byte* Data() const
+        {
+            return data;
+        }
+
+        std::size_t Size() const
+        {
+            return size;
+        }
+
+        std::span<const std::byte> Bytes() const
+        {
+            return {data, size};
+        }
+
+      private:
+        MappedFile(const std::byte* data, std::size_t size)
+            : data{data}
+            , size{size}
+        {
+        }
+
+        void Unmap();
+
+        const std::byte* data = nullptr;
+        std::size_t size = 0;
+    };
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Color.hpp"
+#include "Vector3.hpp"
+
+#include <cmath>
+#include <numbers>
+
+namespace RayTracer
+{
+    /**
+     * A surface reflectance model: a Lambertian diffuse term plus an energy normalized Blinn-Phong specular lobe. A
+     * Lambert material has no specular part. The members are all floats so that batch kernels can gather them
+     * straight from an array of materials.
+     */
+    struct Material
+    {
+        Color diffuse;
+        Color specular;
+        // Blinn-Phong exponent, larger values give a tighter highlight.
+        float shininess = 1.0f;
+
+        static Material Lambert(const Color& albedo)
+        {
+            return {albedo, {0.0f, 0.0f, 0.0f}, 1.0f};
+        }
+
+        static Material BlinnPhong(const Color& diffuse, const Color& specular, float shininess)
+        {
+            return {diffuse, specular, shininess};
+        }
+
+        /**
+         * Normalization of the Blinn-Phong lobe, so that the specular color bounds the reflected energy.
+         */
+        static float SpecularNormalization(float shininess)
+        {
+            return (shininess + 8.0f) * (0.125f * std::numbers::inv_pi_v<float>);
+        }
+
+        /**
+         * Reflected radiance per unit of irradiance arriving from toLight, i.e. the BRDF times the cosine of the
+         * incident angle. view points from the surface towards the viewer. All directions are unit length.
+         */
+        Color Reflect(const Vector3& normal, const Vector3& view, const Vector3& toLight) const
+        {
+            float cosine = normal.Dot(toLight);
+            if (cosine <= 0.0f)
+            {
+                return {0.0f, 0.0f, 0.0f};
+            }
+
+            Color brdf = diffuse * std::numbers::inv_pi_v<float>;
+            Vector3 halfway = toLight + view;
+            float length = halfway.Length();
+            float normalHalfway = length > 0.0f ? normal.Dot(halfway) / length : 0.0f;
+            if (normalHalfway > 0.0f)
+            {
+                brdf = brdf + specular * (SpecularNormalization(shininess) * std::pow(normalHalfway, shininess));
+            }
+            return brdf * cosine;
+        }
+    };
+
+    static_assert(sizeof(Material) % sizeof(float) == 0);
+}
@@ -2,15 +2,37 @@
 
 #include <cmath>
 #include <limits>
+#include <span>
 
+#include "Simd.hpp"
+#include "Vector3.hpp"
 #include "Vector4.hpp"
 
 namespace RayTracer
 {
+    class ThreadPool;
+
+    /**
+     * Points or directions stored as three separate coordinate arrays of equal length.
+     */
+    struct Vector3Arrays
+    {
+        std::span<float> x;
+        std::span<float> y;
+        std::span<float> z;
+    };
+
+    struct ConstVector3Arrays
+    {
+        std::span<const float> x;
+        std::span<const float> y;
+        std::span<const float> z;
+    };
+
     /**
-     * A 4x4 matrix, stored in column-major order.
+     * A 4x4 matrix, stored in column-major order. With a SIMD backend each column is one aligned __m128.
      */
-    struct Matrix
+    struct alignas(Simd::VectorAlignment) Matrix
     {
         static constexpr int Columns = 4;
         static constexpr int Rows = 4;
@@ -57,6 +79,16 @@ namespace RayTracer
             return elements[row + col * Columns];
         }
 
+        float* Column(int col)
+        {
+            return &elements[col * Rows];
+        }
+
+        const float* Column(int col) const
+        {
+            return &elements[col * Rows];
+        }
+
         bool operator==(const Matrix& other) const
         {
             constexpr float Epsilon = std::numeric_limits<float>::epsilon();
@@ -105,9 +137,42 @@ namespace RayTracer
             return result;
         }
 
+        /**
+         * Composes two transforms so that this one is applied first: column c of the result is the sum over k of
+         * column k of other scaled by this(k, c).
+         */
         Matrix operator*(const Matrix& other) const
         {
             Matrix result;
+#if defined(RAYTRACER_SIMD_AVX2)
+            const __m128* otherColumns = reinterpret_cast<const __m128*>(other.elements);
+            __m256 otherColumn0 = _mm256_broadcast_ps(&otherColumns[0]);
+            __m256 otherColumn1 = _mm256_broadcast_ps(&otherColumns[1]);
+            __m256 otherColumn2 = _mm256_broadcast_ps(&otherColumns[2]);
+            __m256 otherColumn3 = _mm256_broadcast_ps(&otherColumns[3]);
+            // Two result columns per iteration: each 128-bit half broadcasts this(k, c) of its own column.
+            for (int c = 0; c < Columns; c += 2)
+            {
+                __m256 columns = _mm256_loadu_ps(Column(c));
+                __m256 sum = _mm256_mul_ps(otherColumn0, _mm256_permute_ps(columns, 0x00));
+                sum = _mm256_fmadd_ps(otherColumn1, _mm256_permute_ps(columns, 0x55), sum);
+                sum = _mm256_fmadd_ps(otherColumn2, _mm256_permute_ps(columns, 0xAA), sum);
+                sum = _mm256_fmadd_ps(otherColumn3, _mm256_permute_ps(columns, 0xFF), sum);
+                _mm256_storeu_ps(result.Column(c), sum);
+            }
+#elif defined(RAYTRACER_SIMD_SSE4)
+            __m128 otherColumns[Columns] = {_mm_load_ps(other.Column(0)), _mm_load_ps(other.Column(1)),
+                                            _mm_load_ps(other.Column(2)), _mm_load_ps(other.Column(3))};
+            for (int c = 0; c < Columns; ++c)
+            {
+                __m128 column = _mm_load_ps(Column(c));
+                __m128 sum = _mm_mul_ps(otherColumns[0], _mm_shuffle_ps(column, column, 0x00));
+                sum = _mm_add_ps(sum, _mm_mul_ps(otherColumns[1], _mm_shuffle_ps(column, column, 0x55)));
+                sum = _mm_add_ps(sum, _mm_mul_ps(otherColumns[2], _mm_shuffle_ps(column, column, 0xAA)));
+                sum = _mm_add_ps(sum, _mm_mul_ps(otherColumns[3], _mm_shuffle_ps(column, column, 0xFF)));
+                _mm_store_ps(result.Column(c), sum);
+            }
+#else
             for (int c = 0; c < Columns; ++c)
             {
                 for (int r = 0; r < Rows; ++r)
@@ -120,19 +185,55 @@ namespace RayTracer
                     result.elements[r + c * Columns] = sum;
                 }
             }
+#endif
             return result;
         }
 
         Vector4 operator*(const Vector4& vec) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            __m128 v = vec.Load();
+            __m128 sum = _mm_mul_ps(_mm_load_ps(Column(0)), _mm_shuffle_ps(v, v, 0x00));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(Column(1)), _mm_shuffle_ps(v, v, 0x55)));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(Column(2)), _mm_shuffle_ps(v, v, 0xAA)));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(Column(3)), _mm_shuffle_ps(v, v, 0xFF)));
+            return Vector4{sum};
+#else
             Vector4 result;
             result.x = elements[0] * vec.x + elements[4] * vec.y + elements[8] * vec.z + elements[12] * vec.w;
             result.y = elements[1] * vec.x + elements[5] * vec.y + elements[9] * vec.z + elements[13] * vec.w;
             result.z = elements[2] * vec.x + elements[6] * vec.y + elements[10] * vec.z + elements[14] * vec.w;
             result.w = elements[3] * vec.x + elements[7] * vec.y + elements[11] * vec.z + elements[15] * vec.w;
             return result;
+#endif
         }
 
+        /**
+         * Batch versions of operator*(Vector4) with w = 1 for points and w = 0 for directions. out receives one result
+         * per element of in and may alias it. Only the first min(in, out) elements are transformed, and the bottom row
+         * of the matrix is ignored.
+         */
+        void TransformPoints(std::span<const Vector3> in, std::span<Vector3> out) const;
+
+        void TransformPoints(const ConstVector3Arrays& in, const Vector3Arrays& out) const;
+
+        void TransformDirections(std::span<const Vector3> in, std::span<Vector3> out) const;
+
+        void TransformDirections(const ConstVector3Arrays& in, const Vector3Arrays& out) const;
+
+        /**
+         * Parallel versions of the batch transforms for very large spans. The input is split into chunks that are run
+         * with ThreadPool::ParallelFor, so these may also be called from a pool task. Small spans are transformed on
+         * the calling thread.
+         */
+        void TransformPoints(ThreadPool& pool, std::span<const Vector3> in, std::span<Vector3> out) const;
+
+        void TransformPoints(ThreadPool& pool, const ConstVector3Arrays& in, const Vector3Arrays& out) const;
+
+        void TransformDirections(ThreadPool& pool, std::span<const Vector3> in, std::span<Vector3> out) const;
+
+        void TransformDirections(ThreadPool& pool, const ConstVector3Arrays& in, const Vector3Arrays& out) const;
+
         Matrix Transpose() const
         {
             Matrix result;
@@ -174,6 +275,9 @@ namespace RayTracer
 
         float Determinant() const;
 
+        /**
+         * Returns the inverse, or the identity when the matrix is singular.
+         */
         Matrix Inverse() const;
 
         static Matrix Translation(const Vector3& translation)
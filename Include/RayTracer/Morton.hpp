@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+namespace RayTracer
+{
+    /**
+     * Spreads the low 16 bits of value so that bit i moves to bit 2i.
+     */
+    constexpr std::uint32_t MortonSpread(std::uint32_t value)
+    {
+        value &= 0x0000FFFF;
+        value = (value | (value << 8)) & 0x00FF00FF;
+        value = (value | (value << 4)) & 0x0F0F0F0F;
+        value = (value | (value << 2)) & 0x33333333;
+        value = (value | (value << 1)) & 0x55555555;
+        return value;
+    }
+
+    /**
+     * Inverse of MortonSpread: gathers the even bits of value into the low 16 bits.
+     */
+    constexpr std::uint32_t MortonCompact(std::uint32_t value)
+    {
+        value &= 0x55555555;
+        value = (value | (value >> 1)) & 0x33333333;
+        value = (value | (value >> 2)) & 0x0F0F0F0F;
+        value = (value | (value >> 4)) & 0x00FF00FF;
+        value = (value | (value >> 8)) & 0x0000FFFF;
+        return value;
+    }
+
+    /**
+     * Position of (x, y) along the Z-order curve, for coordinates below 65536. Points that are close on the curve
+     * are close in the plane, which keeps consecutive work in the same region of the image and the scene.
+     */
+    constexpr std::uint32_t MortonEncode(std::uint32_t x, std::uint32_t y)
+    {
+        return MortonSpread(x) | (MortonSpread(y) << 1);
+    }
+
+    constexpr void MortonDecode(std::uint32_t code, std::uint32_t& x, std::uint32_t& y)
+    {
+        x = MortonCompact(code);
+        y = MortonCompact(code >> 1);
+    }
+
+    /**
+     * Spreads the low 10 bits of value so that bit i moves to bit 3i.
+     */
+    constexpr std::uint32_t MortonSpread3(std::uint32_t value)
+    {
+        value &= 0x000003FF;
+        value = (value | (value << 16)) & 0x030000FF;
+        value = (value | (value << 8)) & 0x0300F00F;
+        value = (value | (value << 4)) & 0x030C30C3;
+        value = (value | (value << 2)) & 0x09249249;
+        return value;
+    }
+
+    /**
+     * Position of (x, y, z) along the three dimensional Z-order curve, for coordinates below 1024.
+     */
+    constexpr std::uint32_t MortonEncode(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+    {
+        return MortonSpread3(x) | (MortonSpread3(y) << 1) | (MortonSpread3(z) << 2);
+    }
+}
@@ -4,6 +4,15 @@
 
 namespace RayTracer
 {
+    /**
+     * Selects the Ray constructor that trusts the caller to pass a unit length direction.
+     */
+    struct UnitDirectionTag
+    {
+    };
+
+    inline constexpr UnitDirectionTag UnitDirection{};
+
     struct Ray
     {
         Vector3 origin;
@@ -21,6 +30,15 @@ namespace RayTracer
         {
         }
 
+        /**
+         * Takes direction as is, skipping the normalization. direction must already be unit length.
+         */
+        constexpr Ray(const Vector3& origin, const Vector3& direction, UnitDirectionTag) noexcept
+            : origin{origin}
+            , direction{direction}
+        {
+        }
+
         Vector3 At(float t) const
         {
             return origin + t * direction;
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Ray.hpp"
+#include "Vector3.hpp"
+
+#include <limits>
+
+namespace RayTracer
+{
+    /**
+     * Eight rays stored as a structure of arrays, so that each component of all lanes can be loaded into a single
+     * AVX register.
+     */
+    struct alignas(32) RayPacket8
+    {
+        static constexpr int Size = 8;
+
+        float originX[Size];
+        float originY[Size];
+        float originZ[Size];
+        float directionX[Size];
+        float directionY[Size];
+        float directionZ[Size];
+
+        constexpr RayPacket8() noexcept
+            : originX{}
+            , originY{}
+            , originZ{}
+            , directionX{}
+            , directionY{}
+            , directionZ{}
+        {
+            for (int i = 0; i < Size; ++i)
+            {
+                directionZ[i] = 1.0f;
+            }
+        }
+
+        void Set(int lane, const Ray& ray)
+        {
+            originX[lane] = ray.origin.x;
+            originY[lane] = ray.origin.y;
+            originZ[lane] = ray.origin.z;
+            directionX[lane] = ray.direction.x;
+            directionY[lane] = ray.direction.y;
+            directionZ[lane] = ray.direction.z;
+        }
+
+        Ray Get(int lane) const
+        {
+            // The lanes hold already normalized rays, so bypass the normalizing constructor.
+            Ray ray;
+            ray.origin = {originX[lane], originY[lane], originZ[lane]};
+            ray.direction = {directionX[lane], directionY[lane], directionZ[lane]};
+            return ray;
+        }
+    };
+
+    /**
+     * Eight rays prepared for packet traversal, the packet counterpart of TraversalRay: every lane carries its inverse
+     * direction and a [tMin, tMax] interval. Lanes with an empty interval are inactive and never report a hit, which
+     * is how partial packets are padded. A default constructed packet has all lanes inactive.
+     */
+    struct alignas(32) TraversalPacket8
+    {
+        RayPacket8 rays;
+        float inverseDirectionX[RayPacket8::Size];
+        float inverseDirectionY[RayPacket8::Size];
+        float inverseDirectionZ[RayPacket8::Size];
+        float tMin[RayPacket8::Size];
+        float tMax[RayPacket8::Size];
+
+        constexpr TraversalPacket8() noexcept
+            : inverseDirectionX{}
+            , inverseDirectionY{}
+            , inverseDirectionZ{}
+            , tMin{}
+            , tMax{}
+        {
+            for (int i = 0; i < RayPacket8::Size; ++i)
+            {
+                inverseDirectionX[i] = std::numeric_limits<float>::infinity();
+                inverseDirectionY[i] = std::numeric_limits<float>::infinity();
+                inverseDirectionZ[i] = 1.0f;
+                tMax[i] = -1.0f;
+            }
+        }
+
+        void Set(int lane, const Ray& ray, float tMin = 0.0f, float tMax = std::numeric_limits<float>::infinity())
+        {
+            rays.Set(lane, ray);
+            inverseDirectionX[lane] = 1.0f / ray.direction.x;
+            inverseDirectionY[lane] = 1.0f / ray.direction.y;
+            inverseDirectionZ[lane] = 1.0f / ray.direction.z;
+            this->tMin[lane] = tMin;
+            this->tMax[lane] = tMax;
+        }
+
+        bool Active(int lane) const
+        {
+            return tMin[lane] <= tMax[lane];
+        }
+    };
+}
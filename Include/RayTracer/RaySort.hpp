@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Aabb.hpp"
+#include "Morton.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+
+namespace RayTracer
+{
+    /**
+     * Computes sort keys that bring coherent rays together. The direction octant forms the top bits, so rays that
+     * traverse an accelerator in the same child order are grouped first. The origin, quantized within bounds and
+     * interleaved along a Morton curve, forms the low bits, so that within an octant rays starting close to each
+     * other visit the same nodes one after another.
+     */
+    class RaySortKey
+    {
+      public:
+        // Quantization of each origin coordinate.
+        static constexpr int OriginBits = 9;
+        static constexpr int Bits = 3 + 3 * OriginBits;
+
+        /**
+         * Origins are quantized relative to bounds. Origins outside it are clamped to its faces.
+         */
+        explicit RaySortKey(const Aabb& bounds);
+
+        std::uint32_t operator()(const Vector3& origin, const Vector3& direction) const
+        {
+            std::uint32_t octant = (std::signbit(direction.x) ? 1u : 0u) | (std::signbit(direction.y) ? 2u : 0u) |
+                                   (std::signbit(direction.z) ? 4u : 0u);
+            return (octant << (3 * OriginBits)) |
+                   MortonEncode(Quantize(origin.x, 0), Quantize(origin.y, 1), Quantize(origin.z, 2));
+        }
+
+      private:
+        std::uint32_t Quantize(float value, int axis) const
+        {
+            constexpr float Largest = static_cast<float>((1 << OriginBits) - 1);
+            return static_cast<std::uint32_t>(std::clamp((value - minimum[axis]) * scale[axis], 0.0f, Largest));
+        }
+
+        Vector3 minimum;
+        Vector3 scale;
+    };
+
+    /**
+     * Stable least significant digit radix sort of keys, carrying values along. Keys must fit in their low keyBits
+     * bits, which bounds the number of passes. The scratch spans must be at least as large as keys and receive
+     * intermediate passes. Passes in which all keys share the same digit are skipped.
+     */
+    void RadixSort(std::span<std::uint32_t> keys, std::span<std::uint32_t> values, std::span<std::uint32_t> keyScratch,
+                   std::span<std::uint32_t> valueScratch, int keyBits = 32);
+}
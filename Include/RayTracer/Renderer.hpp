@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Arena.hpp"
+#include "Morton.hpp"
+#include "ThreadPool.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * A rectangular block of pixels, the unit of work handed to the render threads.
+     */
+    struct Tile
+    {
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    /**
+     * The order in which tiles are scheduled and pixels within a tile are visited. Morton order follows the Z-order
+     * curve, so consecutive rays stay close in the image and the scene, which keeps acceleration structure nodes and
+     * framebuffer cache lines hot.
+     */
+    enum class PixelOrder
+    {
+        Scanline,
+        Morton,
+    };
+
+    /**
+     * Calls function(x, y) for every pixel of tile in the given order. Morton order walks the curve over the
+     * enclosing power of two square and skips pixels outside clipped tiles.
+     */
+    template <typename Function>
+    void ForEachPixel(const Tile& tile, PixelOrder order, Function&& function)
+    {
+        if (order == PixelOrder::Scanline)
+        {
+            for (int y = tile.y; y < tile.y + tile.height; ++y)
+            {
+                for (int x = tile.x; x < tile.x + tile.width; ++x)
+                {
+                    function(x, y);
+                }
+            }
+            return;
+        }
+
+        std::uint32_t side = 1;
+        while (side < static_cast<std::uint32_t>(tile.width) || side < static_cast<std::uint32_t>(tile.height))
+        {
+            side *= 2;
+        }
+        for (std::uint32_t code = 0; code < side * side; ++code)
+        {
+            std::uint32_t x;
+            std::uint32_t y;
+            MortonDecode(code, x, y);
+            if (x < static_cast<std::uint32_t>(tile.width) && y < static_cast<std::uint32_t>(tile.height))
+            {
+                function(tile.x + static_cast<int>(x), tile.y + static_cast<int>(y));
+            }
+        }
+    }
+
+    /**
+     * Statistics of one Renderer::Render call. workers has one entry per worker of the pool and a last one for the
+     * calling thread, with busy and tasks counting the time spent on and the number of tiles rendered. steals counts
+     * the pool tasks a worker stole from other queues during the call, including tasks of other users of the pool.
+     */
+    struct RenderStats
+    {
+        std::chrono::nanoseconds wall{0};
+        std::vector<ThreadPool::WorkerStats> workers;
+
+        /**
+         * Fraction of the wall time that the given worker spent rendering tiles.
+         */
+        double Utilization(unsigned worker) const
+        {
+            if (wall.count() == 0)
+            {
+                return 0.0;
+            }
+            return static_cast<double>(workers[worker].busy.count()) / static_cast<double>(wall.count());
+        }
+    };
+
+    /**
+     * Splits the framebuffer into tiles and renders them on a work stealing thread pool and the calling thread, in
+     * the configured order. Every worker has its own scratch Arena, which is reset after each tile.
+     */
+    class Renderer
+    {
+      public:
+        using TileFunction = std::function<void(const Tile& tile, unsigned worker)>;
+        using RowsFunction = std::function<void(int firstRow, int rowCount)>;
+
+        static constexpr int DefaultTileSize = 32;
+
+        explicit Renderer(ThreadPool& pool, int tileSize = DefaultTileSize, PixelOrder order = PixelOrder::Morton);
+
+        /**
+         * Calls renderTile once for every tile of a width x height image and returns when all tiles are done. If
+         * rowsDone is set, it is called as soon as all tiles of a band of rows are finished, e.g. to stream them to
+         * disk. Calls to rowsDone are serialized but may arrive in any order.
+         *
+         * The tiles are split with ThreadPool::ParallelFor, so Render waits for its own tiles only and may be called
+         * from inside a pool task. The worker passed to renderTile is in [0, ThreadCount()], where ThreadCount() is
+         * the calling thread when it is not a worker of the pool. Because that index has a single arena, at most one
+         * thread outside the pool may render with a Renderer at a time.
+         */
+        RenderStats Render(int width, int height, const TileFunction& renderTile, const RowsFunction& rowsDone = {});
+
+        static std::vector<Tile> SplitTiles(int width, int height, int tileSize,
+                                            PixelOrder order = PixelOrder::Scanline);
+
+        /**
+         * The scratch arena of a worker index passed to the tile function, for data that only lives while a tile
+         * renders. Only the given worker may use it, from inside the tile function.
+         */
+        Arena& Scratch(unsigned worker)
+        {
+            return *arenas[worker];
+        }
+
+        int TileSize() const
+        {
+            return tileSize;
+        }
+
+        /**
+         * The tile order, which tile functions should also use within tiles, see ForEachPixel.
+         */
+        PixelOrder Order() const
+        {
+            return order;
+        }
+
+      private:
+        ThreadPool& pool;
+        int tileSize;
+        PixelOrder order;
+        // Separate allocations keep the arenas of different workers off shared cache lines.
+        std::vector<std::unique_ptr<Arena>> arenas;
+    };
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Bvh.hpp"
+#include "InstancedScene.hpp"
+#include "MappedFile.hpp"
+#include "SphereSoA.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <ostream>
+#include <span>
+#include <utility>
+
+namespace RayTracer
+{
+    enum class SnapshotError
+    {
+        CannotOpen,
+        CannotMap,
+        // Too small for a header or the magic does not match.
+        NotASnapshot,
+        UnsupportedVersion,
+        // Written by a build with a different byte order, SIMD setting or struct layout.
+        LayoutMismatch,
+        // Sections that do not fit the file or disagree with each other.
+        Corrupt,
+    };
+
+    /**
+     * A binary scene file that is memory mapped and used in place. It holds the sphere SoA arrays, the instances and
+     * a built BVH, each in its own section aligned to a cache line, so loading is a single mmap and nothing is parsed
+     * or copied. The file records the sizes of the stored structs and the SIMD alignment, and a file written by an
+     * incompatible build is rejected rather than converted. Pages are shared by all processes mapping the same file.
+     */
+    class SceneSnapshot
+    {
+      public:
+        static constexpr std::uint32_t Version = 1;
+        static constexpr std::size_t SectionAlignment = 64;
+
+        SceneSnapshot() = default;
+
+        /**
+         * Writes a snapshot to a binary stream. Errors are reported through the stream state. The BVH is the only
+         * geometry of a snapshot, so every instance must refer to geometry 0.
+         */
+        static void Write(std::ostream& stream, const SphereSoAView& spheres, const BvhView& bvh,
+                          std::span<const Instance> instances);
+
+        /**
+         * Maps a snapshot file read-only and validates it. Besides the header and the section bounds, one pass over
+         * the BVH nodes, primitive indices and instances checks every index that traversal follows, so a corrupt file
+         * is rejected instead of being read out of bounds. Sphere coordinates and transforms are not checked.
+         */
+        static std::expected<SceneSnapshot, SnapshotError> Open(const std::filesystem::path& path);
+
+        SphereSoAView Spheres() const;
+
+        BvhView Hierarchy() const;
+
+        std::span<const Instance> Instances() const;
+
+        std::size_t Size() const
+        {
+            return file.Size();
+        }
+
+      private:
+        explicit SceneSnapshot(MappedFile file)
+            : file{std::move(file)}
+        {
+        }
+
+        template <typename T>
+        std::span<const T> Section(int section) const;
+
+        MappedFile file;
+    };
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Light.hpp"
+#include "Material.hpp"
+#include "Matrix.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace RayTracer
+{
+    /**
+     * Surface points to shade, stored as arrays of equal length. view points from each point towards the viewer and
+     * material indexes the material array passed to the kernel.
+     */
+    struct SurfaceBatch
+    {
+        ConstVector3Arrays position;
+        ConstVector3Arrays normal;
+        ConstVector3Arrays view;
+        std::span<const std::uint32_t> material;
+    };
+
+    /**
+     * Per point result of sampling one light: the unit direction and distance to the light, which together make the
+     * shadow ray, and the radiance reflected towards the viewer if that ray is unoccluded. The distance is infinite
+     * for directional lights.
+     */
+    struct LightSamples
+    {
+        Vector3Arrays toLight;
+        std::span<float> distance;
+        std::span<float> r;
+        std::span<float> g;
+        std::span<float> b;
+    };
+
+    /**
+     * Evaluates Material::Reflect for one light at every point of surfaces, scaled by the light's irradiance at that
+     * point. With AVX2 eight points are shaded per iteration, with their materials gathered from the material array.
+     * The sample arrays must be at least as long as the batch, and every material ID of the batch must be an index
+     * into materials: IDs are not checked, and the AVX2 path gathers from the array unguarded.
+     */
+    void SampleLight(const SurfaceBatch& surfaces, std::span<const Material> materials, const Light& light,
+                     const LightSamples& samples);
+}
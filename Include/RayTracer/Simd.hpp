@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+// The SIMD backend is selected at configure time through the RAYTRACER_SIMD cache variable, which defines
+// RAYTRACER_SIMD_SSE4 and/or RAYTRACER_SIMD_AVX2 on the RayTracer_Lib target. AVX2 implies SSE4.
+#if defined(RAYTRACER_SIMD_AVX2) && !defined(RAYTRACER_SIMD_SSE4)
+#define RAYTRACER_SIMD_SSE4
+#endif
+
+#if defined(RAYTRACER_SIMD_SSE4)
+#include <immintrin.h>
+#endif
+
+namespace RayTracer::Simd
+{
+#if defined(RAYTRACER_SIMD_SSE4)
+    inline constexpr bool Enabled = true;
+    inline constexpr std::size_t VectorAlignment = 16;
+#else
+    inline constexpr bool Enabled = false;
+    inline constexpr std::size_t VectorAlignment = alignof(float);
+#endif
+
+#if defined(RAYTRACER_SIMD_SSE4)
+    /**
+     * Clears the fourth lane so that padded three component types keep a zero in their padding.
+     */
+    inline __m128 ClearW(__m128 v)
+    {
+        return _mm_blend_ps(v, _mm_setzero_ps(), 0b1000);
+    }
+
+    /**
+     * Cross product of the xyz lanes of two vectors. The w lane of the result is zero.
+     */
+    inline __m128 Cross3(__m128 a, __m128 b)
+    {
+        __m128 aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYzx), _mm_mul_ps(aYzx, b));
+        return ClearW(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+    }
+#endif
+
+#if defined(RAYTRACER_SIMD_AVX2)
+    /**
+     * Base 2 logarithm of positive, normal floats, accurate to a few ulp. The mantissa is reduced to
+     * [sqrt(1/2), sqrt(2)) and the natural logarithm evaluated with the series of 2 atanh((m - 1) / (m + 1)).
+     */
+    inline __m256 Log2(__m256 x)
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        __m256i bits = _mm256_castps_si256(x);
+        __m256i exponent = _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127));
+        __m256 mantissa = _mm256_or_ps(_mm256_castsi256_ps(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF))), one);
+
+        __m256 large = _mm256_cmp_ps(mantissa, _mm256_set1_ps(1.41421356f), _CMP_GT_OQ);
+        mantissa = _mm256_blendv_ps(mantissa, _mm256_mul_ps(mantissa, _mm256_set1_ps(0.5f)), large);
+        __m256 e = _mm256_add_ps(_mm256_cvtepi32_ps(exponent), _mm256_and_ps(large, one));
+
+        __m256 t = _mm256_div_ps(_mm256_sub_ps(mantissa, one), _mm256_add_ps(mantissa, one));
+        __m256 t2 = _mm256_mul_ps(t, t);
+        __m256 series = _mm256_fmadd_ps(t2, _mm256_set1_ps(1.0f / 9.0f), _mm256_set1_ps(1.0f / 7.0f));
+        series = _mm256_fmadd_ps(series, t2, _mm256_set1_ps(1.0f / 5.0f));
+        series = _mm256_fmadd_ps(series, t2, _mm256_set1_ps(1.0f / 3.0f));
+        series = _mm256_fmadd_ps(series, t2, one);
+        // 2 / ln(2) turns 2 atanh into log2.
+        return _mm256_fmadd_ps(_mm256_mul_ps(t, series), _mm256_set1_ps(2.88539008f), e);
+    }
+
+    /**
+     * 2^x, with x clamped to the normal float range. The fraction after rounding lies in [-1/2, 1/2], where a
+     * degree 6 Taylor polynomial is accurate to single precision.
+     */
+    inline __m256 Exp2(__m256 x)
+    {
+        x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-126.0f)), _mm256_set1_ps(126.0f));
+        __m256 n = _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        __m256 f = _mm256_sub_ps(x, n);
+
+        __m256 p = _mm256_set1_ps(1.540353e-4f);
+        p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(1.3333558e-3f));
+        p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(9.6181291e-3f));
+        p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(5.5504109e-2f));
+        p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(2.4022651e-1f));
+        p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(6.9314718e-1f));
+        p = _mm256_fmadd_ps(p, f, _mm256_set1_ps(1.0f));
+
+        __m256i scale = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+        return _mm256_mul_ps(p, _mm256_castsi256_ps(scale));
+    }
+
+    /**
+     * x^y for x in [0, 1] and y > 0, with 0^y = 0.
+     */
+    inline __m256 PowUnit(__m256 x, __m256 y)
+    {
+        __m256 positive = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ);
+        __m256 safe = _mm256_max_ps(x, _mm256_set1_ps(std::numeric_limits<float>::min()));
+        return _mm256_and_ps(Exp2(_mm256_mul_ps(y, Log2(safe))), positive);
+    }
+#endif
+}
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "Aabb.hpp"
+#include "Hit.hpp"
 #include "Ray.hpp"
+#include "RayPacket.hpp"
 #include "Vector3.hpp"
 
 #include <cmath>
@@ -16,6 +19,22 @@ namespace RayTracer
             float t2 = 0.0f;
         };
 
+        /**
+         * The result of intersecting a RayPacket8 with a sphere. Bit i of hitMask is set when lane i hit, and
+         * t1/t2 follow the same rules as RayIntersection for every lane.
+         */
+        struct PacketIntersection
+        {
+            int hitMask = 0;
+            alignas(32) float t1[RayPacket8::Size] = {};
+            alignas(32) float t2[RayPacket8::Size] = {};
+
+            bool Hit(int lane) const
+            {
+                return (hitMask & (1 << lane)) != 0;
+            }
+        };
+
         Vector3 center;
         float radius;
 
@@ -33,6 +52,59 @@ namespace RayTracer
 
         RayIntersection Intersect(const Ray& ray) const;
 
+        /**
+         * Finds the nearest root with tMin <= t <= tMax using the half-b quadratic, relying on the unit length
+         * direction of Ray. Roots outside the interval are rejected before anything else is computed, so passing the
+         * closest hit so far as tMax prunes this sphere early.
+         */
+        bool Intersect(const Ray& ray, float tMin, float tMax, float& t) const;
+
+        /**
+         * Like the overload above, but returns a complete Hit record. primitive is left at zero.
+         */
+        Hit Intersect(const Ray& ray, float tMin, float tMax) const
+        {
+            Hit hit;
+            if (Intersect(ray, tMin, tMax, hit.t))
+            {
+                hit.hit = true;
+                CompleteHit(ray, hit);
+            }
+            return hit;
+        }
+
+        /**
+         * Fills position, normal and frontFace of a hit on this sphere at hit.t. The normal is normalized by dividing
+         * by the radius instead of taking a square root.
+         */
+        void CompleteHit(const Ray& ray, Hit& hit) const
+        {
+            hit.position = ray.At(hit.t);
+            Vector3 outward = (hit.position - center) / radius;
+            hit.frontFace = ray.direction.Dot(outward) < 0.0f;
+            hit.normal = hit.frontFace ? outward : -outward;
+        }
+
+        PacketIntersection Intersect(const RayPacket8& packet) const;
+
+        /**
+         * Any-hit query for shadow rays: whether the sphere surface is crossed at some tMin <= t <= tMax. The
+         * direction must be unit length, as it is for every Ray. Stops at the first root inside the interval and
+         * builds no intersection record.
+         */
+        bool Occluded(const Ray& ray, float tMin, float tMax) const;
+
+        bool Occluded(const Ray& ray, float tMax) const
+        {
+            return Occluded(ray, 0.0f, tMax);
+        }
+
+        Aabb Bounds() const
+        {
+            Vector3 extent{radius, radius, radius};
+            return {center - extent, center + extent};
+        }
+
         Vector3 NormalAt(const Vector3& point) const
         {
             return (point - center).Normalized();
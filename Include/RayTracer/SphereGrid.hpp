@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Aabb.hpp"
+#include "Hit.hpp"
+#include "Ray.hpp"
+#include "Sphere.hpp"
+#include "TraversalRay.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace RayTracer
+{
+    struct SphereGridOptions
+    {
+        // Target number of cells per sphere. The resolution of each axis follows from it and the scene extent.
+        float density = 2.0f;
+        int maxResolution = 256;
+        // Cells referencing more spheres than this get their own nested grid. Zero disables the second level.
+        std::uint32_t subdivideThreshold = 0;
+        // Threads used by the build, zero picks the hardware concurrency.
+        unsigned threadCount = 0;
+    };
+
+    /**
+     * A uniform grid over spheres traversed with a 3D DDA. The build is a parallel counting sort of sphere references
+     * into cells and runs in O(n), which makes it a good fit for dense, evenly distributed scenes that are rebuilt
+     * often. With a subdivide threshold set it becomes a two-level grid, where crowded cells hold a nested grid.
+     */
+    class SphereGrid
+    {
+      public:
+        struct Level
+        {
+            Aabb bounds;
+            int resolution[3] = {0, 0, 0};
+            float cellSize[3] = {0.0f, 0.0f, 0.0f};
+            float inverseCellSize[3] = {0.0f, 0.0f, 0.0f};
+            // References of cell i are references[cellStart[i]] up to references[cellStart[i + 1]].
+            std::vector<std::uint32_t> cellStart;
+            std::vector<std::uint32_t> references;
+
+            int CellIndex(int x, int y, int z) const
+            {
+                return x + resolution[0] * (y + resolution[1] * z);
+            }
+        };
+
+        SphereGrid() = default;
+
+        explicit SphereGrid(std::span<const Sphere> spheres, const SphereGridOptions& options = {});
+
+        Hit ClosestHit(const Ray& ray) const
+        {
+            return ClosestHit(TraversalRay{ray});
+        }
+
+        Hit ClosestHit(const TraversalRay& ray) const;
+
+        /**
+         * Whether any sphere is hit inside the ray interval. Traversal stops at the first hit found, in any order.
+         */
+        bool Occluded(const TraversalRay& ray) const;
+
+        bool Occluded(const Ray& ray, float tMax) const
+        {
+            return Occluded(TraversalRay{ray, 0.0f, tMax});
+        }
+
+        const Level& TopLevel() const
+        {
+            return top;
+        }
+
+        std::size_t SubgridCount() const
+        {
+            return subgrids.size();
+        }
+
+      private:
+        std::vector<Sphere> spheres;
+        Level top;
+        // Index into subgrids for every top level cell, or -1 when the cell is not subdivided.
+        std::vector<std::int32_t> subgridIndex;
+        std::vector<Level> subgrids;
+    };
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "AlignedAllocator.hpp"
+#include "Hit.hpp"
+#include "Ray.hpp"
+#include "Sphere.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * Non-owning access to spheres stored as a structure of arrays, e.g. a SphereSoA or arrays mapped in place from a
+     * SceneSnapshot. The arrays must be 32 byte aligned and hold paddedCount entries, a multiple of SphereSoA::Width,
+     * where the entries past count have NaN centers so they are never hit.
+     */
+    class SphereSoAView
+    {
+      public:
+        SphereSoAView() = default;
+
+        SphereSoAView(std::size_t count, std::size_t paddedCount, const float* centerX, const float* centerY,
+                      const float* centerZ, const float* radius)
+            : count{count}
+            , paddedCount{paddedCount}
+            , centerX{centerX}
+            , centerY{centerY}
+            , centerZ{centerZ}
+            , radius{radius}
+        {
+        }
+
+        std::size_t Size() const
+        {
+            return count;
+        }
+
+        std::size_t PaddedSize() const
+        {
+            return paddedCount;
+        }
+
+        Sphere operator[](std::size_t index) const
+        {
+            return {{centerX[index], centerY[index], centerZ[index]}, radius[index]};
+        }
+
+        const float* CenterX() const
+        {
+            return centerX;
+        }
+
+        const float* CenterY() const
+        {
+            return centerY;
+        }
+
+        const float* CenterZ() const
+        {
+            return centerZ;
+        }
+
+        const float* Radius() const
+        {
+            return radius;
+        }
+
+        /**
+         * Finds the closest sphere hit by the ray, using the same root selection as Sphere::Intersect.
+         */
+        Hit NearestHit(const Ray& ray) const;
+
+      private:
+        std::size_t count = 0;
+        std::size_t paddedCount = 0;
+        const float* centerX = nullptr;
+        const float* centerY = nullptr;
+        const float* centerZ = nullptr;
+        const float* radius = nullptr;
+    };
+
+    /**
+     * A collection of spheres stored as a structure of arrays. Centers and radii live in separate 32 byte aligned
+     * arrays that are padded to a multiple of Width with spheres that can never be hit, so that NearestHit can sweep
+     * the whole collection with vector instructions and no scalar tail.
+     */
+    class SphereSoA
+    {
+      public:
+        static constexpr std::size_t Width = 8;
+
+        using FloatArray = std::vector<float, AlignedAllocator<float, 32>>;
+
+        SphereSoA() = default;
+
+        explicit SphereSoA(std::span<const Sphere> spheres);
+
+        void Reserve(std::size_t capacity);
+
+        void Add(const Sphere& sphere);
+
+        /**
+         * Sets the number of spheres. New spheres are unit spheres at the origin until they are Set. Together with Set
+         * this lets several threads fill disjoint ranges of the arrays in place.
+         */
+        void Resize(std::size_t newCount);
+
+        void Set(std::size_t index, const Sphere& sphere)
+        {
+            centerX[index] = sphere.center.x;
+            centerY[index] = sphere.center.y;
+            centerZ[index] = sphere.center.z;
+            radius[index] = sphere.radius;
+        }
+
+        void Clear();
+
+        std::size_t Size() const
+        {
+            return count;
+        }
+
+        Sphere operator[](std::size_t index) const
+        {
+            return {{centerX[index], centerY[index], centerZ[index]}, radius[index]};
+        }
+
+        const float* CenterX() const
+        {
+            return centerX.data();
+        }
+
+        const float* CenterY() const
+        {
+            return centerY.data();
+        }
+
+        const float* CenterZ() const
+        {
+            return centerZ.data();
+        }
+
+        const float* Radius() const
+        {
+            return radius.data();
+        }
+
+        SphereSoAView View() const
+        {
+            return {count, centerX.size(), centerX.data(), centerY.data(), centerZ.data(), radius.data()};
+        }
+
+        /**
+         * Finds the closest sphere hit by the ray, using the same root selection as Sphere::Intersect.
+         */
+        Hit NearestHit(const Ray& ray) const
+        {
+            return View().NearestHit(ray);
+        }
+
+      private:
+        std::size_t count = 0;
+        FloatArray centerX;
+        FloatArray centerY;
+        FloatArray centerZ;
+        FloatArray radius;
+    };
+}
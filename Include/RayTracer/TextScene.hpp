@@ -0,0 +1,58 @@
+#pragma once
+
+#include "InstancedScene.hpp"
+#include "SphereSoA.hpp"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace RayTracer
+{
+    class ThreadPool;
+
+    struct TextSceneError
+    {
+        // One based line of the error, zero when it concerns the whole file.
+        std::size_t line = 0;
+        const char* message = "";
+    };
+
+    /**
+     * The text scene format, one object per line:
+     *
+     *     # comment
+     *     sphere <x> <y> <z> <radius>
+     *     instance <geometry> <m00> <m01> <m02> <m03> <m10> ... <m23>
+     *
+     * An instance line holds the top three rows of its affine matrix in row-major order. Blank lines are ignored and
+     * a # starts a comment anywhere on a line.
+     *
+     * Parsing splits the text into chunks at line boundaries and runs in two parallel passes: the first counts the
+     * objects in every chunk, which fixes where each chunk writes, and the second parses the chunks straight into the
+     * final SphereSoA and instance arrays with std::from_chars. Nothing is allocated per object.
+     */
+    struct TextScene
+    {
+        SphereSoA spheres;
+        std::vector<Instance> instances;
+
+        static std::expected<TextScene, TextSceneError> Parse(std::string_view text, ThreadPool& pool);
+
+        /**
+         * Maps the file read-only and parses the mapping in place, see MappedFile. The workers fault the pages of
+         * their chunks in themselves, so reading overlaps with parsing and the text is never copied into memory.
+         */
+        static std::expected<TextScene, TextSceneError> Load(const std::filesystem::path& path, ThreadPool& pool);
+
+        /**
+         * Writes spheres and instances in the text format, with floats in their shortest round trip form. Errors
+         * are reported through the stream state.
+         */
+        static void Write(std::ostream& stream, const SphereSoAView& spheres, std::span<const Instance> instances);
+    };
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * A fixed size pool of worker threads with one task queue per worker. Workers take tasks from the back of their
+     * own queue and steal from the front of other queues when it runs dry, which keeps all cores busy when tasks have
+     * uneven cost.
+     */
+    class ThreadPool
+    {
+      public:
+        using Task = std::function<void(unsigned worker)>;
+
+        struct WorkerStats
+        {
+            std::chrono::nanoseconds busy{0};
+            std::uint64_t tasks = 0;
+            std::uint64_t steals = 0;
+        };
+
+        /**
+         * Creates threadCount workers, or one per hardware thread when threadCount is zero.
+         */
+        explicit ThreadPool(unsigned threadCount = 0);
+
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        unsigned ThreadCount() const
+        {
+            return static_cast<unsigned>(workers.size());
+        }
+
+        /**
+         * Queues a task. Tasks are spread over the worker queues round robin.
+         */
+        void Submit(Task task);
+
+        /**
+         * Blocks until every submitted task has finished. Must not be called from a task, whose own pending count
+         * would keep the pool from ever becoming idle. Use ParallelFor for work that is split up inside a task.
+         */
+        void Wait();
+
+        /**
+         * The index of the calling thread if it is a worker of this pool, and ThreadCount() for any other thread.
+         */
+        unsigned CurrentWorker() const;
+
+        /**
+         * Calls function(i) for every i in [0, count) on the workers and the calling thread, and returns once all of
+         * these calls have finished. Completion is tracked per call instead of waiting for the pool to become idle, so
+         * it may be called from inside a task and while unrelated work is queued. The calling thread claims indices
+         * itself, so the call completes even when every worker is busy elsewhere.
+         *
+         * A function that also takes an unsigned is called as function(i, worker), where worker is the index of the
+         * thread running it, or ThreadCount() for a calling thread outside the pool, see CurrentWorker. No two calls
+         * of one ParallelFor run concurrently with the same index.
+         */
+        template <typename Function>
+        void ParallelFor(std::size_t count, const Function& function)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            // Shared, because helper tasks that only start after all indices are claimed may outlive the call.
+            struct State
+            {
+                std::atomic<std::size_t> next = 0;
+                std::latch done;
+                const Function* function;
+
+                State(std::size_t count, const Function* function)
+                    : done{static_cast<std::ptrdiff_t>(count)}
+                    , function{function}
+                {
+                }
+            };
+            auto state = std::make_shared<State>(count, &function);
+            auto work = [state, count](unsigned worker) {
+                for (std::size_t i = state->next.fetch_add(1, std::memory_order_relaxed); i < count;
+                     i = state->next.fetch_add(1, std::memory_order_relaxed))
+                {
+                    if constexpr (std::invocable<const Function&, std::size_t, unsigned>)
+                    {
+                        (*state->function)(i, worker);
+                    }
+                    else
+                    {
+                        (*state->function)(i);
+                    }
+                    state->done.count_down();
+                }
+            };
+
+            std::size_t helpers = std::min<std::size_t>(count - 1, ThreadCount());
+            for (std::size_t i = 0; i < helpers; ++i)
+            {
+                Submit(work);
+            }
+            work(CurrentWorker());
+            state->done.wait();
+        }
+
+        /**
+         * Per worker statistics accumulated since construction or the last ResetStats. May be called while tasks run,
+         * in which case the tasks still running are not counted yet. Users of a shared pool should compare two
+         * snapshots rather than reset the statistics of everyone else.
+         */
+        std::vector<WorkerStats> Stats() const;
+
+        void ResetStats();
+
+      private:
+        struct Worker
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+            WorkerStats stats;
+        };
+
+        bool TryPop(unsigned index, Task& task);
+
+        bool TrySteal(unsigned index, Task& task);
+
+        void Run(unsigned index);
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::vector<std::jthread> threads;
+
+        std::mutex mutex;
+        std::condition_variable workAvailable;
+        std::condition_variable allDone;
+        // Tasks sitting in a queue, and tasks submitted but not yet finished.
+        std::atomic<std::size_t> queued = 0;
+        std::size_t pending = 0;
+        bool stopping = false;
+        std::atomic<unsigned> nextQueue = 0;
+    };
+}
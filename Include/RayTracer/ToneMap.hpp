@@ -0,0 +1,161 @@
+#pragma once
+
+#include "AlignedAllocator.hpp"
+#include "Color.hpp"
+#include "Framebuffer.hpp"
+#include "Renderer.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * Packs 8-bit channels into one pixel with red in the lowest byte, i.e. R, G, B, A in memory on little endian
+     * machines.
+     */
+    constexpr std::uint32_t PackRgba8(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a = 255)
+    {
+        return static_cast<std::uint32_t>(r) | static_cast<std::uint32_t>(g) << 8 |
+               static_cast<std::uint32_t>(b) << 16 | static_cast<std::uint32_t>(a) << 24;
+    }
+
+    /**
+     * Channel 0 to 3 (R, G, B, A) of a pixel packed with PackRgba8.
+     */
+    constexpr std::uint8_t Rgba8Channel(std::uint32_t pixel, int channel)
+    {
+        return static_cast<std::uint8_t>(pixel >> (8 * channel));
+    }
+
+    /**
+     * A width x height image of packed RGBA8 pixels, see PackRgba8. Like Framebuffer, every row starts on a cache
+     * line boundary.
+     */
+    class Rgba8Image
+    {
+      public:
+        static constexpr std::size_t CacheLineSize = Framebuffer::CacheLineSize;
+
+        Rgba8Image() = default;
+
+        Rgba8Image(int width, int height);
+
+        int Width() const
+        {
+            return width;
+        }
+
+        int Height() const
+        {
+            return height;
+        }
+
+        /**
+         * Distance between the starts of two rows, in pixels.
+         */
+        std::size_t Stride() const
+        {
+            return stride;
+        }
+
+        std::uint32_t& At(int x, int y)
+        {
+            return pixels[static_cast<std::size_t>(y) * stride + x];
+        }
+
+        std::uint32_t At(int x, int y) const
+        {
+            return pixels[static_cast<std::size_t>(y) * stride + x];
+        }
+
+        std::span<std::uint32_t> Row(int y)
+        {
+            return {pixels.data() + static_cast<std::size_t>(y) * stride, static_cast<std::size_t>(width)};
+        }
+
+        std::span<const std::uint32_t> Row(int y) const
+        {
+            return {pixels.data() + static_cast<std::size_t>(y) * stride, static_cast<std::size_t>(width)};
+        }
+
+      private:
+        int width = 0;
+        int height = 0;
+        std::size_t stride = 0;
+        std::vector<std::uint32_t, AlignedAllocator<std::uint32_t, CacheLineSize>> pixels;
+    };
+
+    enum class ToneMapOperator
+    {
+        // Clamps to [0, 1] without compressing highlights.
+        Clamp,
+        // x / (1 + x) per channel.
+        Reinhard,
+        // Narkowicz's fit of the ACES filmic curve per channel.
+        Aces,
+    };
+
+    /**
+     * Converts linear colors to 8-bit sRGB: each channel is scaled by the exposure, tone mapped, clamped to [0, 1]
+     * and encoded with the sRGB transfer curve, which is looked up in a table instead of evaluating std::pow. With
+     * AVX2 eight pixels are converted per iteration, with the table read through gathers. Alpha is always opaque.
+     */
+    class ToneMapper
+    {
+      public:
+        struct Settings
+        {
+            float exposure = 1.0f;
+            ToneMapOperator toneMap = ToneMapOperator::Clamp;
+        };
+
+        // Entries of the sRGB table over [0, 1]. The table step is small enough that a lookup differs from exact
+        // rounding by at most one, and only for values within a fraction of a step of a rounding boundary.
+        static constexpr int LutSize = 1 << 14;
+        // Pixels per side of the tiles converted by the parallel Convert. Conversion is cheap per pixel and streams
+        // through memory, so tiles are much larger than render tiles, which keeps the rows read by a task long enough
+        // for the hardware prefetcher.
+        static constexpr int DefaultTileSize = 256;
+
+        ToneMapper();
+
+        explicit ToneMapper(const Settings& settings);
+
+        /**
+         * Converts the first min(in.size(), out.size()) colors.
+         */
+        void ConvertRow(std::span<const Color> in, std::span<std::uint32_t> out) const;
+
+        /**
+         * Converts the pixels of tile. image must have the size of framebuffer.
+         */
+        void ConvertTile(const Framebuffer& framebuffer, const Tile& tile, Rgba8Image& image) const;
+
+        /**
+         * Converts the whole framebuffer tile by tile with ThreadPool::ParallelFor, so the calling thread converts
+         * tiles too and the call may come from inside a pool task, such as a progress callback of the renderer.
+         * image must have the size of framebuffer.
+         */
+        void Convert(ThreadPool& pool, const Framebuffer& framebuffer, Rgba8Image& image,
+                     int tileSize = DefaultTileSize) const;
+
+        /**
+         * The tone mapped value of one channel, after exposure and clamping.
+         */
+        float ToneMap(float value) const;
+
+        /**
+         * The exact sRGB transfer curve for values in [0, 1], which the table approximates.
+         */
+        static float LinearToSrgb(float value);
+
+      private:
+        Settings settings;
+        // Bytes of the encoded curve, padded so that 32-bit gathers at the last entry stay inside the allocation.
+        std::vector<std::uint8_t> lut;
+    };
+}
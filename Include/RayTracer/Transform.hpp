@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Matrix.hpp"
+#include "Vector3.hpp"
+
+namespace RayTracer
+{
+    /**
+     * An affine transform stored as a 3x3 linear part and a translation, i.e. a 3x4 matrix with an implicit
+     * (0, 0, 0, 1) bottom row. The inverse and the inverse-transpose used for normals are computed once when the
+     * transform is built or composed, so transforming points, vectors and normals never inverts anything.
+     */
+    class Transform
+    {
+      public:
+        /**
+         * The identity transform.
+         */
+        Transform();
+
+        /**
+         * Takes the affine part of matrix and ignores its bottom row.
+         */
+        explicit Transform(const Matrix& matrix);
+
+        static Transform Translation(const Vector3& translation)
+        {
+            return Transform{Matrix::Translation(translation)};
+        }
+
+        static Transform Scaling(const Vector3& scale)
+        {
+            return Transform{Matrix::Scaling(scale)};
+        }
+
+        static Transform RotationX(float angle)
+        {
+            return Transform{Matrix::RotationX(angle)};
+        }
+
+        static Transform RotationY(float angle)
+        {
+            return Transform{Matrix::RotationY(angle)};
+        }
+
+        static Transform RotationZ(float angle)
+        {
+            return Transform{Matrix::RotationZ(angle)};
+        }
+
+        static Transform Shear(float xy, float xz, float yx, float yz, float zx, float zy)
+        {
+            return Transform{Matrix::Shear(xy, xz, yx, yz, zx, zy)};
+        }
+
+        /**
+         * Composes two transforms with the same convention as Matrix: this one is applied first. The inverse is
+         * composed from the cached inverses rather than recomputed.
+         */
+        Transform operator*(const Transform& other) const;
+
+        /**
+         * Returns the inverse transform. This only swaps the cached parts, nothing is inverted. The inverse of a
+         * singular transform is the identity, as for Matrix::Inverse.
+         */
+        Transform Inverse() const;
+
+        Matrix ToMatrix() const;
+
+        Vector3 TransformPoint(const Vector3& point) const
+        {
+            return linear[0] * point.x + linear[1] * point.y + linear[2] * point.z + translation;
+        }
+
+        Vector3 TransformVector(const Vector3& vector) const
+        {
+            return linear[0] * vector.x + linear[1] * vector.y + linear[2] * vector.z;
+        }
+
+        /**
+         * Applies the cached inverse, e.g. to move world space rays into object space.
+         */
+        Vector3 InverseTransformPoint(const Vector3& point) const
+        {
+            return inverseLinear[0] * point.x + inverseLinear[1] * point.y + inverseLinear[2] * point.z +
+                   inverseTranslation;
+        }
+
+        Vector3 InverseTransformVector(const Vector3& vector) const
+        {
+            return inverseLinear[0] * vector.x + inverseLinear[1] * vector.y + inverseLinear[2] * vector.z;
+        }
+
+        /**
+         * Transforms a surface normal by the inverse-transpose of the linear part. The result is not normalized.
+         */
+        Vector3 TransformNormal(const Vector3& normal) const
+        {
+            return normalLinear[0] * normal.x + normalLinear[1] * normal.y + normalLinear[2] * normal.z;
+        }
+
+      private:
+        Transform(const Vector3 (&linear)[3], const Vector3& translation, const Vector3 (&inverseLinear)[3],
+                  const Vector3& inverseTranslation);
+
+        // All linear parts are stored as columns, so applying one is a sum of scaled columns.
+        Vector3 linear[3];
+        Vector3 translation;
+        Vector3 inverseLinear[3];
+        Vector3 inverseTranslation;
+        // Transpose of inverseLinear.
+        Vector3 normalLinear[3];
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Ray.hpp"
+#include "Vector3.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace RayTracer
+{
+    /**
+     * A ray prepared for acceleration structure traversal. The inverse direction and the per-axis direction signs
+     * are computed once here instead of at every node, and only hits with tMin <= t <= tMax are reported.
+     */
+    struct TraversalRay
+    {
+        Ray ray;
+        Vector3 inverseDirection;
+        // 1 where the direction has its sign bit set, matching the sign of the inverse direction even for -0. Indexes
+        // {min, max} bounds to get the plane the ray enters through first.
+        int sign[3];
+        float tMin;
+        float tMax;
+
+        explicit TraversalRay(const Ray& ray, float tMin = 0.0f,
+                              float tMax = std::numeric_limits<float>::infinity()) noexcept
+            : ray{ray}
+            , inverseDirection{1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z}
+            , sign{std::signbit(ray.direction.x) ? 1 : 0, std::signbit(ray.direction.y) ? 1 : 0,
+                   std::signbit(ray.direction.z) ? 1 : 0}
+            , tMin{tMin}
+            , tMax{tMax}
+        {
+        }
+    };
+}
@@ -1,15 +1,24 @@
 #pragma once
 
+#include "Simd.hpp"
+
 #include <cmath>
 #include <limits>
 
 namespace RayTracer
 {
-    struct Vector3
+    /**
+     * A three component vector. With the SIMD backend enabled it is padded to 16 bytes so that it can be loaded
+     * into a single SSE register.
+     */
+    struct alignas(Simd::VectorAlignment) Vector3
     {
         float x;
         float y;
         float z;
+#if defined(RAYTRACER_SIMD_SSE4)
+        float padding = 0.0f;
+#endif
 
         constexpr Vector3() noexcept
             : x{0}
@@ -25,6 +34,28 @@ namespace RayTracer
         {
         }
 
+#if defined(RAYTRACER_SIMD_SSE4)
+        explicit Vector3(__m128 v) noexcept
+        {
+            _mm_store_ps(&x, Simd::ClearW(v));
+        }
+
+        __m128 Load() const
+        {
+            return _mm_load_ps(&x);
+        }
+#endif
+
+        float& operator[](int axis)
+        {
+            return axis == 0 ? x : axis == 1 ? y : z;
+        }
+
+        const float& operator[](int axis) const
+        {
+            return axis == 0 ? x : axis == 1 ? y : z;
+        }
+
         bool operator==(const Vector3& other) const
         {
             constexpr float Epsilon = std::numeric_limits<float>::epsilon();
@@ -39,32 +70,56 @@ namespace RayTracer
 
         Vector3 operator+(const Vector3& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector3{_mm_add_ps(Load(), other.Load())};
+#else
             return {x + other.x, y + other.y, z + other.z};
+#endif
         }
 
         Vector3 operator-(const Vector3& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector3{_mm_sub_ps(Load(), other.Load())};
+#else
             return {x - other.x, y - other.y, z - other.z};
+#endif
         }
 
         Vector3 operator-() const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector3{_mm_xor_ps(Load(), _mm_set1_ps(-0.0f))};
+#else
             return {-x, -y, -z};
+#endif
         }
 
         Vector3 operator*(float scalar) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector3{_mm_mul_ps(Load(), _mm_set1_ps(scalar))};
+#else
             return {x * scalar, y * scalar, z * scalar};
+#endif
         }
 
         Vector3 operator/(float scalar) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector3{_mm_div_ps(Load(), _mm_set1_ps(scalar))};
+#else
             return {x / scalar, y / scalar, z / scalar};
+#endif
         }
 
         float LengthSquared() const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return _mm_cvtss_f32(_mm_dp_ps(Load(), Load(), 0x71));
+#else
             return x * x + y * y + z * z;
+#endif
         }
 
         float Length() const
@@ -74,6 +129,9 @@ namespace RayTracer
 
         void Normalize()
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            *this = Normalized();
+#else
             float len = Length();
             if (len > 0.0f)
             {
@@ -81,26 +139,44 @@ namespace RayTracer
                 y /= len;
                 z /= len;
             }
+#endif
         }
 
         Vector3 Normalized() const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            __m128 v = Load();
+            __m128 len = _mm_sqrt_ps(_mm_dp_ps(v, v, 0x7F));
+            if (_mm_cvtss_f32(len) > 0.0f)
+            {
+                return Vector3{_mm_div_ps(v, len)};
+            }
+#else
             float len = Length();
             if (len > 0.0f)
             {
                 return {x / len, y / len, z / len};
             }
+#endif
             return *this;
         }
 
         float Dot(const Vector3& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return _mm_cvtss_f32(_mm_dp_ps(Load(), other.Load(), 0x71));
+#else
             return x * other.x + y * other.y + z * other.z;
+#endif
         }
 
         Vector3 Cross(const Vector3& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector3{Simd::Cross3(Load(), other.Load())};
+#else
             return {y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x};
+#endif
         }
     };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Simd.hpp"
 #include "Vector3.hpp"
 
 #include <cmath>
@@ -7,7 +8,7 @@
 
 namespace RayTracer
 {
-    struct Vector4
+    struct alignas(Simd::VectorAlignment) Vector4
     {
         float x;
         float y;
@@ -38,6 +39,18 @@ namespace RayTracer
         {
         }
 
+#if defined(RAYTRACER_SIMD_SSE4)
+        explicit Vector4(__m128 v) noexcept
+        {
+            _mm_store_ps(&x, v);
+        }
+
+        __m128 Load() const
+        {
+            return _mm_load_ps(&x);
+        }
+#endif
+
         bool operator==(const Vector4& other) const
         {
             constexpr float Epsilon = std::numeric_limits<float>::epsilon();
@@ -52,32 +65,56 @@ namespace RayTracer
 
         Vector4 operator+(const Vector4& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector4{_mm_add_ps(Load(), other.Load())};
+#else
             return {x + other.x, y + other.y, z + other.z, w + other.w};
+#endif
         }
 
         Vector4 operator-(const Vector4& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector4{_mm_sub_ps(Load(), other.Load())};
+#else
             return {x - other.x, y - other.y, z - other.z, w - other.w};
+#endif
         }
 
         Vector4 operator-() const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector4{_mm_xor_ps(Load(), _mm_set1_ps(-0.0f))};
+#else
             return {-x, -y, -z, -w};
+#endif
         }
 
         Vector4 operator*(float scalar) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector4{_mm_mul_ps(Load(), _mm_set1_ps(scalar))};
+#else
             return {x * scalar, y * scalar, z * scalar, w * scalar};
+#endif
         }
 
         Vector4 operator/(float scalar) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return Vector4{_mm_div_ps(Load(), _mm_set1_ps(scalar))};
+#else
             return {x / scalar, y / scalar, z / scalar, w / scalar};
+#endif
         }
 
         float LengthSquared() const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return _mm_cvtss_f32(_mm_dp_ps(Load(), Load(), 0xF1));
+#else
             return x * x + y * y + z * z + w * w;
+#endif
         }
 
         float Length() const
@@ -87,6 +124,9 @@ namespace RayTracer
 
         void Normalize()
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            *this = Normalized();
+#else
             float len = Length();
             if (len > 0.0f)
             {
@@ -95,21 +135,35 @@ namespace RayTracer
                 z /= len;
                 w /= len;
             }
+#endif
         }
 
         Vector4 Normalized() const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            __m128 v = Load();
+            __m128 len = _mm_sqrt_ps(_mm_dp_ps(v, v, 0xFF));
+            if (_mm_cvtss_f32(len) > 0.0f)
+            {
+                return Vector4{_mm_div_ps(v, len)};
+            }
+#else
             float len = Length();
             if (len > 0.0f)
             {
                 return {x / len, y / len, z / len, w / len};
             }
+#endif
             return *this;
         }
 
         float Dot(const Vector4& other) const
         {
+#if defined(RAYTRACER_SIMD_SSE4)
+            return _mm_cvtss_f32(_mm_dp_ps(Load(), other.Load(), 0xF1));
+#else
             return x * other.x + y * other.y + z * other.z + w * other.w;
+#endif
         }
     };
 
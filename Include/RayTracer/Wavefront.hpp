@@ -0,0 +1,361 @@
+#pragma once
+
+#include "Accelerator.hpp"
+#include "Arena.hpp"
+#include "Camera.hpp"
+#include "Color.hpp"
+#include "Framebuffer.hpp"
+#include "Light.hpp"
+#include "Material.hpp"
+#include "RaySort.hpp"
+#include "Renderer.hpp"
+#include "Shading.hpp"
+#include "TraversalRay.hpp"
+#include "Vector3.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * Paths in flight, stored as a structure of arrays. Every path carries the ray of its next segment, the
+     * throughput accumulated so far, the tile pixel it contributes to and its random number state.
+     */
+    struct PathQueue
+    {
+        ScratchVector<float> originX;
+        ScratchVector<float> originY;
+        ScratchVector<float> originZ;
+        ScratchVector<float> directionX;
+        ScratchVector<float> directionY;
+        ScratchVector<float> directionZ;
+        ScratchVector<float> throughputR;
+        ScratchVector<float> throughputG;
+        ScratchVector<float> throughputB;
+        ScratchVector<std::uint32_t> pixel;
+        ScratchVector<std::uint32_t> random;
+        std::size_t size = 0;
+
+        PathQueue(std::size_t capacity, std::pmr::memory_resource* memory);
+
+        Ray GetRay(std::size_t index) const
+        {
+            return {{originX[index], originY[index], originZ[index]},
+                    {directionX[index], directionY[index], directionZ[index]},
+                    UnitDirection};
+        }
+    };
+
+    /**
+     * The closest hit of every path in a PathQueue, at the same index. t is infinite for paths that escaped.
+     */
+    struct HitQueue
+    {
+        ScratchVector<float> t;
+        ScratchVector<float> normalX;
+        ScratchVector<float> normalY;
+        ScratchVector<float> normalZ;
+        ScratchVector<std::uint32_t> material;
+
+        HitQueue(std::size_t capacity, std::pmr::memory_resource* memory);
+    };
+
+    /**
+     * The paths of a PathQueue that hit a surface, as the hit records shaded by SampleLight, along with the samples
+     * of the light currently being shaded. path is the index of each hit in the PathQueue.
+     */
+    struct SurfaceQueue
+    {
+        ScratchVector<float> positionX;
+        ScratchVector<float> positionY;
+        ScratchVector<float> positionZ;
+        ScratchVector<float> normalX;
+        ScratchVector<float> normalY;
+        ScratchVector<float> normalZ;
+        ScratchVector<float> viewX;
+        ScratchVector<float> viewY;
+        ScratchVector<float> viewZ;
+        ScratchVector<std::uint32_t> material;
+        ScratchVector<std::uint32_t> path;
+        ScratchVector<float> toLightX;
+        ScratchVector<float> toLightY;
+        ScratchVector<float> toLightZ;
+        ScratchVector<float> lightDistance;
+        ScratchVector<float> radianceR;
+        ScratchVector<float> radianceG;
+        ScratchVector<float> radianceB;
+        std::size_t size = 0;
+
+        SurfaceQueue(std::size_t capacity, std::pmr::memory_resource* memory);
+
+        SurfaceBatch Batch() const
+        {
+            return {{std::span{positionX}.first(size), std::span{positionY}.first(size),
+                     std::span{positionZ}.first(size)},
+                    {std::span{normalX}.first(size), std::span{normalY}.first(size), std::span{normalZ}.first(size)},
+                    {std::span{viewX}.first(size), std::span{viewY}.first(size), std::span{viewZ}.first(size)},
+                    std::span{material}.first(size)};
+        }
+
+        LightSamples Samples()
+        {
+            return {{toLightX, toLightY, toLightZ}, lightDistance, radianceR, radianceG, radianceB};
+        }
+    };
+
+    /**
+     * Shadow rays towards a light, which end at tMax. Each adds its contribution to its pixel when nothing blocks it.
+     */
+    struct ShadowQueue
+    {
+        ScratchVector<float> originX;
+        ScratchVector<float> originY;
+        ScratchVector<float> originZ;
+        ScratchVector<float> directionX;
+        ScratchVector<float> directionY;
+        ScratchVector<float> directionZ;
+        ScratchVector<float> tMax;
+        ScratchVector<float> contributionR;
+        ScratchVector<float> contributionG;
+        ScratchVector<float> contributionB;
+        ScratchVector<std::uint32_t> pixel;
+        std::size_t size = 0;
+
+        ShadowQueue(std::size_t capacity, std::pmr::memory_resource* memory);
+
+        Ray GetRay(std::size_t index) const
+        {
+            return {{originX[index], originY[index], originZ[index]},
+                    {directionX[index], directionY[index], directionZ[index]},
+                    UnitDirection};
+        }
+    };
+
+    /**
+     * Keys and permutation used to reorder a PathQueue, with the scratch space of the radix sort.
+     */
+    struct SortQueue
+    {
+        ScratchVector<std::uint32_t> keys;
+        ScratchVector<std::uint32_t> order;
+        ScratchVector<std::uint32_t> keyScratch;
+        ScratchVector<std::uint32_t> orderScratch;
+
+        SortQueue(std::size_t capacity, std::pmr::memory_resource* memory);
+    };
+
+    /**
+     * Radiance summed over all samples of every tile pixel.
+     */
+    struct Accumulator
+    {
+        ScratchVector<float> r;
+        ScratchVector<float> g;
+        ScratchVector<float> b;
+
+        Accumulator(std::size_t capacity, std::pmr::memory_resource* memory);
+    };
+
+    /**
+     * A path tracer organized as a wavefront: instead of following one path at a time through recursive calls, all
+     * paths of a tile advance together through a sequence of stages, each a batch kernel over an SoA queue:
+     *
+     * - Generate fills the queue with primary rays from the camera, in the configured pixel order.
+     * - Sort optionally reorders secondary rays by direction octant and origin, see RaySortKey.
+     * - Extend finds the closest hit of every queued ray, eight rays per traversal when the scene is a
+     *   PacketAccelerator.
+     * - Shade terminates escaped paths with the sky, gathers the hits into a SurfaceQueue, samples every light with
+     *   the SampleLight kernel and queues the results as shadow rays. It then samples the diffuse bounce and compacts
+     *   the surviving paths into the queue for the next round.
+     * - Shadow traces the shadow rays, in packets like Extend, and accumulates the unoccluded ones.
+     * - Resolve averages the accumulated samples into the framebuffer.
+     *
+     * Direct light from the point and directional lights is shaded with the full Material, while bounces follow its
+     * diffuse part only, so specular highlights appear in direct light but not in reflections. Paths that escape
+     * see a sky gradient. All queues live in the scratch arena of the rendering worker.
+     */
+    class WavefrontIntegrator
+    {
+      public:
+        struct Settings
+        {
+            int samplesPerPixel = 4;
+            // Maximum number of surface hits per path.
+            int maxDepth = 4;
+            // Depth from which paths are terminated randomly in proportion to their throughput.
+            int rouletteDepth = 2;
+            Color skyHorizon{1.0f, 1.0f, 1.0f};
+            Color skyZenith{0.5f, 0.7f, 1.0f};
+            // Replaced by the default when empty, so that material 0 always exists.
+            std::vector<Material> materials{Material::Lambert({0.7f, 0.7f, 0.7f})};
+            // Material of every primitive, indexed by Hit::primitive. Primitives beyond its end, and IDs past the end
+            // of materials, use material 0.
+            std::vector<std::uint32_t> materialIds;
+            std::vector<Light> lights;
+            // Whether to sort bounce rays before tracing them. Primary rays are coherent already.
+            bool sortRays = false;
+            // Order in which Generate queues the pixels of a tile, usually Renderer::Order().
+            PixelOrder pixelOrder = PixelOrder::Morton;
+        };
+
+        // Offset of secondary rays from the surface they leave, against self intersection.
+        static constexpr float RayEpsilon = 1e-3f;
+
+        /**
+         * The camera is referenced, not copied, and must outlive the integrator. The settings are copied and their
+         * material IDs clamped to valid indices, see Settings::materialIds.
+         */
+        WavefrontIntegrator(const Camera& camera, const Settings& settings);
+
+        /**
+         * Renders all samples of a tile and writes their average to framebuffer.
+         */
+        template <Accelerator Scene>
+        void RenderTile(const Scene& scene, const Tile& tile, Arena& scratch, Framebuffer& framebuffer) const
+        {
+            const std::size_t count = static_cast<std::size_t>(tile.width) * static_cast<std::size_t>(tile.height);
+            PathQueue paths{count, &scratch};
+            PathQueue next{count, &scratch};
+            HitQueue hits{count, &scratch};
+            SurfaceQueue surfaces{count, &scratch};
+            ShadowQueue shadows{count * settings.lights.size(), &scratch};
+            Accumulator accumulator{count, &scratch};
+            SortQueue sortQueue{settings.sortRays ? count : 0, &scratch};
+
+            for (int sample = 0; sample < settings.samplesPerPixel; ++sample)
+            {
+                Generate(tile, sample, paths);
+                for (int depth = 0; depth < settings.maxDepth && paths.size > 0; ++depth)
+                {
+                    if (settings.sortRays && depth > 0)
+                    {
+                        Sort(paths, sortQueue, next);
+                        std::swap(paths, next);
+                    }
+                    Extend(scene, paths, hits);
+                    Shade(paths, hits, depth, surfaces, next, shadows, accumulator);
+                    Shadow(scene, shadows, accumulator);
+                    std::swap(paths, next);
+                }
+                // Paths still alive after the last bounce are cut off.
+                paths.size = 0;
+            }
+            Resolve(tile, accumulator, framebuffer);
+        }
+
+        /**
+         * Fills paths with one primary ray per tile pixel, queued in Settings::pixelOrder. PathQueue::pixel is the
+         * row-major index of each path's pixel within the tile, which is the order Resolve writes them back in.
+         */
+        void Generate(const Tile& tile, int sample, PathQueue& paths) const;
+
+        /**
+         * Writes the paths to sorted in the order of their RaySortKey, with origins quantized within their own
+         * bounds. Paths with equal keys keep their order. The order of the paths does not change the image, only
+         * the memory access pattern of the following stages.
+         */
+        static void Sort(const PathQueue& paths, SortQueue& sortQueue, PathQueue& sorted);
+
+        template <Accelerator Scene>
+        void Extend(const Scene& scene, const PathQueue& paths, HitQueue& hits) const
+        {
+            if constexpr (PacketAccelerator<Scene>)
+            {
+                for (std::size_t begin = 0; begin < paths.size; begin += RayPacket8::Size)
+                {
+                    const int count = static_cast<int>(std::min<std::size_t>(RayPacket8::Size, paths.size - begin));
+                    TraversalPacket8 packet;
+                    for (int lane = 0; lane < count; ++lane)
+                    {
+                        packet.Set(lane, paths.GetRay(begin + lane), RayEpsilon);
+                    }
+                    Hit packetHits[RayPacket8::Size];
+                    scene.ClosestHit(packet, packetHits);
+                    for (int lane = 0; lane < count; ++lane)
+                    {
+                        StoreHit(packetHits[lane], begin + lane, hits);
+                    }
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < paths.size; ++i)
+                {
+                    StoreHit(scene.ClosestHit(TraversalRay{paths.GetRay(i), RayEpsilon}), i, hits);
+                }
+            }
+        }
+
+        /**
+         * Shades every path of paths and writes the ones that continue to next, in order. Resets surfaces, next
+         * and shadows first.
+         */
+        void Shade(const PathQueue& paths, const HitQueue& hits, int depth, SurfaceQueue& surfaces, PathQueue& next,
+                   ShadowQueue& shadows, Accumulator& accumulator) const;
+
+        template <Accelerator Scene>
+        void Shadow(const Scene& scene, const ShadowQueue& shadows, Accumulator& accumulator) const
+        {
+            if constexpr (PacketAccelerator<Scene>)
+            {
+                for (std::size_t begin = 0; begin < shadows.size; begin += RayPacket8::Size)
+                {
+                    const int count = static_cast<int>(std::min<std::size_t>(RayPacket8::Size, shadows.size - begin));
+                    TraversalPacket8 packet;
+                    for (int lane = 0; lane < count; ++lane)
+                    {
+                        packet.Set(lane, shadows.GetRay(begin + lane), RayEpsilon, shadows.tMax[begin + lane]);
+                    }
+                    const int occluded = scene.Occluded(packet);
+                    for (int lane = 0; lane < count; ++lane)
+                    {
+                        if ((occluded & (1 << lane)) == 0)
+                        {
+                            AccumulateShadow(shadows, begin + lane, accumulator);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < shadows.size; ++i)
+                {
+                    if (!scene.Occluded(TraversalRay{shadows.GetRay(i), RayEpsilon, shadows.tMax[i]}))
+                    {
+                        AccumulateShadow(shadows, i, accumulator);
+                    }
+                }
+            }
+        }
+
+        void Resolve(const Tile& tile, const Accumulator& accumulator, Framebuffer& framebuffer) const;
+
+      private:
+        const Camera& camera;
+        Settings settings;
+
+        void StoreHit(const Hit& hit, std::size_t i, HitQueue& hits) const
+        {
+            hits.t[i] = hit.hit ? hit.t : std::numeric_limits<float>::infinity();
+            hits.normalX[i] = hit.normal.x;
+            hits.normalY[i] = hit.normal.y;
+            hits.normalZ[i] = hit.normal.z;
+            hits.material[i] =
+                hit.primitive < settings.materialIds.size() ? settings.materialIds[hit.primitive] : 0;
+        }
+
+        static void AccumulateShadow(const ShadowQueue& shadows, std::size_t i, Accumulator& accumulator)
+        {
+            std::uint32_t pixel = shadows.pixel[i];
+            accumulator.r[pixel] += shadows.contributionR[i];
+            accumulator.g[pixel] += shadows.contributionG[i];
+            accumulator.b[pixel] += shadows.contributionB[i];
+        }
+    };
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Bvh.hpp"
+#include "Hit.hpp"
+#include "Ray.hpp"
+#include "Sphere.hpp"
+#include "TraversalRay.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace RayTracer
+{
+    /**
+     * A BVH with Width children per node, collapsed from a binary Bvh. Child bounds are stored as a structure of
+     * arrays so that a single SSE (Width 4) or AVX (Width 8) slab test checks all children of a node at once.
+     * Children are sorted along the split axis of the binary node they were collapsed from, so that traversal can
+     * visit them front to back based on the sign of the ray direction on that axis.
+     */
+    template <int Width>
+    class WideBvh
+    {
+      public:
+        static_assert(Width == 4 || Width == 8, "WideBvh supports 4 and 8 wide nodes");
+
+        struct alignas(32) Node
+        {
+            float minX[Width];
+            float minY[Width];
+            float minZ[Width];
+            float maxX[Width];
+            float maxY[Width];
+            float maxZ[Width];
+            // Interior child: index of the child node. Leaf child: index of the first primitive.
+            std::uint32_t child[Width];
+            // Number of primitives of a leaf child, zero for interior children.
+            std::uint16_t count[Width];
+            std::uint8_t childCount;
+            std::uint8_t axis;
+        };
+
+        WideBvh() = default;
+
+        explicit WideBvh(const Bvh& bvh);
+
+        /**
+         * Finds the closest sphere hit by the ray. Hit::primitive is the index of the sphere in the span the binary
+         * Bvh was built from.
+         */
+        Hit ClosestHit(const Ray& ray) const
+        {
+            return ClosestHit(TraversalRay{ray});
+        }
+
+        Hit ClosestHit(const TraversalRay& ray) const;
+
+        /**
+         * Whether any sphere is hit inside the ray interval. Traversal stops at the first hit found, in any order.
+         */
+        bool Occluded(const TraversalRay& ray) const;
+
+        bool Occluded(const Ray& ray, float tMax) const
+        {
+            return Occluded(TraversalRay{ray, 0.0f, tMax});
+        }
+
+        std::span<const Node> Nodes() const
+        {
+            return nodes;
+        }
+
+      private:
+        std::uint32_t Collapse(std::span<const BvhNode> binary, std::uint32_t binaryIndex);
+
+        std::vector<Node> nodes;
+        std::vector<std::uint32_t> primitiveIndices;
+        std::vector<Sphere> spheres;
+    };
+
+    using Bvh4 = WideBvh<4>;
+    using Bvh8 = WideBvh<8>;
+
+    extern template class WideBvh<4>;
+    extern template class WideBvh<8>;
+}
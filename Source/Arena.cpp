@@ -0,0 +1,100 @@
+#include "RayTracer/Arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace RayTracer
+{
+    namespace
+    {
+        constexpr std::size_t BlockAlignment = alignof(std::max_align_t);
+
+        std::size_t AlignUp(std::uintptr_t address, std::size_t alignment)
+        {
+            return static_cast<std::size_t>((address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1));
+        }
+    }
+
+    Arena::Arena(std::size_t blockSize, std::pmr::memory_resource* upstream)
+        : upstream{upstream}
+        , blockSize{std::max<std::size_t>(blockSize, 1)}
+    {
+    }
+
+    Arena::~Arena()
+    {
+        ReleaseBlocks();
+    }
+
+    void Arena::Reset()
+    {
+        if (blocks.size() > 1)
+        {
+            std::size_t capacity = Capacity();
+            ReleaseBlocks();
+            AddBlock(capacity);
+        }
+        offset = 0;
+        usedInPreviousBlocks = 0;
+    }
+
+    std::size_t Arena::BytesUsed() const
+    {
+        return usedInPreviousBlocks + offset;
+    }
+
+    std::size_t Arena::Capacity() const
+    {
+        std::size_t capacity = 0;
+        for (const Block& block : blocks)
+        {
+            capacity += block.size;
+        }
+        return capacity;
+    }
+
+    void* Arena::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        if (!blocks.empty())
+        {
+            const Block& block = blocks.back();
+            auto base = reinterpret_cast<std::uintptr_t>(block.data);
+            std::size_t start = AlignUp(base + offset, alignment) - base;
+            if (start <= block.size && bytes <= block.size - start)
+            {
+                offset = start + bytes;
+                return block.data + start;
+            }
+        }
+
+        // Padding for alignments beyond the block alignment comes out of the new block.
+        AddBlock(bytes + (alignment > BlockAlignment ? alignment : 0));
+        const Block& block = blocks.back();
+        auto base = reinterpret_cast<std::uintptr_t>(block.data);
+        std::size_t start = AlignUp(base, alignment) - base;
+        offset = start + bytes;
+        return block.data + start;
+    }
+
+    void Arena::AddBlock(std::size_t minimumSize)
+    {
+        // Blocks grow geometrically, so a round that needs a lot of scratch memory only takes a few of them.
+        std::size_t size = blocks.empty() ? blockSize : blocks.back().size * 2;
+        size = std::max(size, minimumSize);
+        if (!blocks.empty())
+        {
+            usedInPreviousBlocks += offset;
+        }
+        blocks.push_back({static_cast<std::byte*>(upstream->allocate(size, BlockAlignment)), size});
+        offset = 0;
+    }
+
+    void Arena::ReleaseBlocks()
+    {
+        for (const Block& block : blocks)
+        {
+            upstream->deallocate(block.data, block.size, BlockAlignment);
+        }
+        blocks.clear();
+    }
+}
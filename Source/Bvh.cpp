@@ -0,0 +1,598 @@
+#include "RayTracer/Bvh.hpp"
+#include "RayTracer/Simd.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <utility>
+
+namespace RayTracer
+{
+    namespace
+    {
+        // Relative cost of visiting a node compared to intersecting one primitive.
+        constexpr float TraversalCost = 1.0f;
+        // Below this depth splits are chosen by SAH, above it by median, which bounds the tree depth to MaxDepth.
+        constexpr int MedianSplitDepth = Bvh::MaxDepth / 2;
+
+        struct Bin
+        {
+            Aabb bounds;
+            std::uint32_t count = 0;
+        };
+
+        struct Builder
+        {
+            std::span<const Aabb> primitiveBounds;
+            std::vector<Vector3> centroids;
+            std::vector<std::uint32_t>& indices;
+            std::vector<BvhNode>& nodes;
+
+            int BinIndex(const Vector3& centroid, int axis, float minimum, float scale) const
+            {
+                int bin = static_cast<int>((centroid[axis] - minimum) * scale);
+                return std::clamp(bin, 0, Bvh::BinCount - 1);
+            }
+
+            std::uint32_t MedianSplit(std::uint32_t begin, std::uint32_t end, int axis)
+            {
+                std::uint32_t mid = begin + (end - begin) / 2;
+                std::nth_element(
+                    indices.begin() + begin, indices.begin() + mid, indices.begin() + end,
+                    [&](std::uint32_t a, std::uint32_t b) { return centroids[a][axis] < centroids[b][axis]; });
+                return mid;
+            }
+
+            void Build(std::uint32_t begin, std::uint32_t end, int depth)
+            {
+                std::uint32_t nodeIndex = static_cast<std::uint32_t>(nodes.size());
+                nodes.push_back({});
+
+                Aabb bounds;
+                Aabb centroidBounds;
+                for (std::uint32_t i = begin; i < end; ++i)
+                {
+                    bounds.Expand(primitiveBounds[indices[i]]);
+                    centroidBounds.Expand(centroids[indices[i]]);
+                }
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    nodes[nodeIndex].boundsMin[axis] = bounds.min[axis];
+                    nodes[nodeIndex].boundsMax[axis] = bounds.max[axis];
+                }
+
+                std::uint32_t count = end - begin;
+                if (count == 1)
+                {
+                    MakeLeaf(nodeIndex, begin, count);
+                    return;
+                }
+
+                Vector3 extent = centroidBounds.Extent();
+                int splitAxis = centroidBounds.LongestAxis();
+                std::uint32_t mid = begin;
+
+                if (depth < MedianSplitDepth)
+                {
+                    float bestCost = std::numeric_limits<float>::infinity();
+                    int bestAxis = -1;
+                    int bestBin = 0;
+                    for (int axis = 0; axis < 3; ++axis)
+                    {
+                        if (extent[axis] <= 0.0f)
+                        {
+                            continue;
+                        }
+
+                        Bin bins[Bvh::BinCount];
+                        float scale = Bvh::BinCount / extent[axis];
+                        for (std::uint32_t i = begin; i < end; ++i)
+                        {
+                            Bin& bin = bins[BinIndex(centroids[indices[i]], axis, centroidBounds.min[axis], scale)];
+                            bin.bounds.Expand(primitiveBounds[indices[i]]);
+                            ++bin.count;
+                        }
+
+                        // Sweep from the left to get the area and count of every left partition, then from the
+                        // right to evaluate each split plane between bins.
+                        float leftArea[Bvh::BinCount - 1];
+                        std::uint32_t leftCount[Bvh::BinCount - 1];
+                        Aabb accumulated;
+                        std::uint32_t accumulatedCount = 0;
+                        for (int b = 0; b < Bvh::BinCount - 1; ++b)
+                        {
+                            accumulated.Expand(bins[b].bounds);
+                            accumulatedCount += bins[b].count;
+                            leftArea[b] = accumulated.SurfaceArea();
+                            leftCount[b] = accumulatedCount;
+                        }
+
+                        accumulated = {};
+                        accumulatedCount = 0;
+                        for (int b = Bvh::BinCount - 1; b > 0; --b)
+                        {
+                            accumulated.Expand(bins[b].bounds);
+                            accumulatedCount += bins[b].count;
+                            if (leftCount[b - 1] == 0 || accumulatedCount == 0)
+                            {
+                                continue;
+                            }
+                            float cost = leftArea[b - 1] * static_cast<float>(leftCount[b - 1]) +
+                                         accumulated.SurfaceArea() * static_cast<float>(accumulatedCount);
+                            if (cost < bestCost)
+                            {
+                                bestCost = cost;
+                                bestAxis = axis;
+                                bestBin = b;
+                            }
+                        }
+                    }
+
+                    if (count <= Bvh::MaxLeafSize)
+                    {
+                        float area = bounds.SurfaceArea();
+                        float splitCost = area > 0.0f ? TraversalCost + bestCost / area : bestCost;
+                        if (bestAxis < 0 || static_cast<float>(count) <= splitCost)
+                        {
+                            MakeLeaf(nodeIndex, begin, count);
+                            return;
+                        }
+                    }
+
+                    if (bestAxis >= 0)
+                    {
+                        splitAxis = bestAxis;
+                        float scale = Bvh::BinCount / extent[bestAxis];
+                        float minimum = centroidBounds.min[bestAxis];
+                        auto middle = std::partition(indices.begin() + begin, indices.begin() + end,
+                                                     [&](std::uint32_t index) {
+                                                         return BinIndex(centroids[index], bestAxis, minimum, scale) <
+                                                                bestBin;
+                                                     });
+                        mid = static_cast<std::uint32_t>(middle - indices.begin());
+                    }
+                }
+
+                if (mid == begin || mid == end)
+                {
+                    if (count <= Bvh::MaxLeafSize)
+                    {
+                        MakeLeaf(nodeIndex, begin, count);
+                        return;
+                    }
+                    mid = MedianSplit(begin, end, splitAxis);
+                }
+
+                Build(begin, mid, depth + 1);
+                nodes[nodeIndex].offset = static_cast<std::uint32_t>(nodes.size());
+                nodes[nodeIndex].count = 0;
+                nodes[nodeIndex].axis = static_cast<std::uint16_t>(splitAxis);
+                Build(mid, end, depth + 1);
+            }
+
+            void MakeLeaf(std::uint32_t nodeIndex, std::uint32_t begin, std::uint32_t count)
+            {
+                nodes[nodeIndex].offset = begin;
+                nodes[nodeIndex].count = static_cast<std::uint16_t>(count);
+                nodes[nodeIndex].axis = 0;
+            }
+        };
+
+#if defined(RAYTRACER_SIMD_AVX2)
+        /**
+         * A TraversalPacket8 loaded into registers, plus the masks of its active lanes and of the lanes whose direction
+         * is negative on each axis.
+         */
+        struct PacketRegisters
+        {
+            __m256 origin[3];
+            __m256 inverseDirection[3];
+            __m256 tMin;
+            __m256 tMax;
+            int active;
+            int negative[3];
+
+            explicit PacketRegisters(const TraversalPacket8& packet)
+                : origin{_mm256_load_ps(packet.rays.originX), _mm256_load_ps(packet.rays.originY),
+                         _mm256_load_ps(packet.rays.originZ)}
+                , inverseDirection{_mm256_load_ps(packet.inverseDirectionX), _mm256_load_ps(packet.inverseDirectionY),
+                                   _mm256_load_ps(packet.inverseDirectionZ)}
+                , tMin{_mm256_load_ps(packet.tMin)}
+                , tMax{_mm256_load_ps(packet.tMax)}
+                , active{_mm256_movemask_ps(_mm256_cmp_ps(tMin, tMax, _CMP_LE_OQ))}
+            {
+                const __m256 zero = _mm256_setzero_ps();
+                const float* directions[3] = {packet.rays.directionX, packet.rays.directionY, packet.rays.directionZ};
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    negative[axis] =
+                        _mm256_movemask_ps(_mm256_cmp_ps(_mm256_load_ps(directions[axis]), zero, _CMP_LT_OQ));
+                }
+            }
+        };
+
+        /**
+         * Slab test of all lanes against one node, clipped to each lane's [tMin, tMax]. Returns the mask of the lanes
+         * that overlap the node. The per lane interval is the second operand of max/min, so a NaN slab distance (origin
+         * on a slab plane of an axis parallel ray) leaves it unchanged, as in the scalar test.
+         */
+        int IntersectNode8(const BvhNode& node, const PacketRegisters& packet, __m256 tMax)
+        {
+            __m256 tNear = packet.tMin;
+            __m256 tFar = tMax;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.boundsMin[axis]), packet.origin[axis]),
+                                          packet.inverseDirection[axis]);
+                __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(node.boundsMax[axis]), packet.origin[axis]),
+                                          packet.inverseDirection[axis]);
+                tNear = _mm256_max_ps(_mm256_min_ps(t0, t1), tNear);
+                tFar = _mm256_min_ps(_mm256_max_ps(t0, t1), tFar);
+            }
+            return _mm256_movemask_ps(_mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ));
+        }
+
+        /**
+         * Expands the hit mask of a PacketIntersection to a lane mask.
+         */
+        __m256 HitLanes(int hitMask)
+        {
+            const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+            return _mm256_castsi256_ps(
+                _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(hitMask), bits), bits));
+        }
+
+        /**
+         * Visit order of the children of an interior node: the near child is the one on the side of the split plane
+         * that most active lanes come from.
+         */
+        void PushChildren(const BvhNode& node, std::uint32_t nodeIndex, const PacketRegisters& packet, int active,
+                          std::uint32_t* stack, int& stackSize)
+        {
+            std::uint32_t nearChild = nodeIndex + 1;
+            std::uint32_t farChild = node.offset;
+            if (2 * std::popcount(static_cast<unsigned>(packet.negative[node.axis] & active)) >
+                std::popcount(static_cast<unsigned>(active)))
+            {
+                std::swap(nearChild, farChild);
+            }
+            stack[stackSize++] = farChild;
+            stack[stackSize++] = nearChild;
+        }
+#endif
+    }
+
+    Bvh::Bvh(std::span<const Sphere> spheres)
+    {
+        std::vector<Aabb> bounds;
+        bounds.reserve(spheres.size());
+        for (const Sphere& sphere : spheres)
+        {
+            bounds.push_back(sphere.Bounds());
+        }
+
+        nodes = Build(bounds, primitiveIndices);
+
+        this->spheres.reserve(spheres.size());
+        for (std::uint32_t index : primitiveIndices)
+        {
+            this->spheres.push_back(spheres[index]);
+        }
+    }
+
+    std::vector<BvhNode> Bvh::Build(std::span<const Aabb> primitiveBounds, std::vector<std::uint32_t>& primitiveIndices)
+    {
+        std::vector<BvhNode> nodes;
+        primitiveIndices.resize(primitiveBounds.size());
+        for (std::uint32_t i = 0; i < primitiveIndices.size(); ++i)
+        {
+            primitiveIndices[i] = i;
+        }
+        if (primitiveBounds.empty())
+        {
+            return nodes;
+        }
+
+        Builder builder{primitiveBounds, {}, primitiveIndices, nodes};
+        builder.centroids.reserve(primitiveBounds.size());
+        for (const Aabb& bounds : primitiveBounds)
+        {
+            builder.centroids.push_back(bounds.Centroid());
+        }
+        nodes.reserve(2 * primitiveBounds.size());
+        builder.Build(0, static_cast<std::uint32_t>(primitiveBounds.size()), 0);
+        nodes.shrink_to_fit();
+        return nodes;
+    }
+
+    Hit BvhView::ClosestHit(const TraversalRay& ray) const
+    {
+        Hit result;
+        if (nodes.empty())
+        {
+            return result;
+        }
+
+        float closest = ray.tMax;
+        std::uint32_t closestSphere = 0;
+
+        struct StackEntry
+        {
+            std::uint32_t node;
+            float tEntry;
+        };
+        StackEntry stack[MaxDepth];
+        int stackSize = 0;
+
+        float tEntry;
+        if (!nodes[0].Intersect(ray, closest, tEntry))
+        {
+            return result;
+        }
+        stack[stackSize++] = {0, tEntry};
+
+        while (stackSize > 0)
+        {
+            StackEntry entry = stack[--stackSize];
+            if (entry.tEntry > closest)
+            {
+                continue;
+            }
+
+            std::uint32_t nodeIndex = entry.node;
+            while (true)
+            {
+                const BvhNode& node = nodes[nodeIndex];
+                if (node.IsLeaf())
+                {
+                    for (std::uint32_t i = node.offset; i < node.offset + node.count; ++i)
+                    {
+                        float t;
+                        if (spheres[i].Intersect(ray.ray, ray.tMin, closest, t))
+                        {
+                            closest = t;
+                            closestSphere = i;
+                            result.hit = true;
+                            result.t = t;
+                            result.primitive = primitiveIndices[i];
+                        }
+                    }
+                    break;
+                }
+
+                // Visit the child on the near side of the split plane first.
+                std::uint32_t nearChild = nodeIndex + 1;
+                std::uint32_t farChild = node.offset;
+                if (ray.sign[node.axis] != 0)
+                {
+                    std::swap(nearChild, farChild);
+                }
+
+                float tNear;
+                float tFar;
+                bool hitNear = nodes[nearChild].Intersect(ray, closest, tNear);
+                bool hitFar = nodes[farChild].Intersect(ray, closest, tFar);
+                if (hitNear && hitFar)
+                {
+                    stack[stackSize++] = {farChild, tFar};
+                    nodeIndex = nearChild;
+                }
+                else if (hitNear)
+                {
+                    nodeIndex = nearChild;
+                }
+                else if (hitFar)
+                {
+                    nodeIndex = farChild;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        if (result.hit)
+        {
+            spheres[closestSphere].CompleteHit(ray.ray, result);
+        }
+        return result;
+    }
+
+    bool BvhView::Occluded(const TraversalRay& ray) const
+    {
+        if (nodes.empty())
+        {
+            return false;
+        }
+
+        std::uint32_t stack[MaxDepth + 1];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        float tEntry;
+        while (stackSize > 0)
+        {
+            std::uint32_t nodeIndex = stack[--stackSize];
+            const BvhNode& node = nodes[nodeIndex];
+            if (!node.Intersect(ray, ray.tMax, tEntry))
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                for (std::uint32_t i = node.offset; i < node.offset + node.count; ++i)
+                {
+                    if (spheres[i].Occluded(ray.ray, ray.tMin, ray.tMax))
+                    {
+                        return true;
+                    }
+                }
+            }
+            else
+            {
+                stack[stackSize++] = node.offset;
+                stack[stackSize++] = nodeIndex + 1;
+            }
+        }
+        return false;
+    }
+
+    void BvhView::ClosestHit(const TraversalPacket8& packet, std::span<Hit, RayPacket8::Size> hits) const
+    {
+        std::ranges::fill(hits, Hit{});
+        if (nodes.empty())
+        {
+            return;
+        }
+
+#if defined(RAYTRACER_SIMD_AVX2)
+        const PacketRegisters registers{packet};
+        if (registers.active == 0)
+        {
+            return;
+        }
+
+        __m256 closest = registers.tMax;
+        __m256i closestSphere = _mm256_setzero_si256();
+        __m256 found = _mm256_setzero_ps();
+
+        std::uint32_t stack[MaxDepth + 1];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            std::uint32_t nodeIndex = stack[--stackSize];
+            const BvhNode& node = nodes[nodeIndex];
+            const int active = IntersectNode8(node, registers, closest) & registers.active;
+            if (active == 0)
+            {
+                continue;
+            }
+
+            if (!node.IsLeaf())
+            {
+                PushChildren(node, nodeIndex, registers, active, stack, stackSize);
+                continue;
+            }
+
+            for (std::uint32_t i = node.offset; i < node.offset + node.count; ++i)
+            {
+                Sphere::PacketIntersection intersection = spheres[i].Intersect(packet.rays);
+                if ((intersection.hitMask & active) == 0)
+                {
+                    continue;
+                }
+                // The nearest root at or past tMin, which is the far root when the near one is too close.
+                __m256 t1 = _mm256_load_ps(intersection.t1);
+                __m256 t = _mm256_blendv_ps(_mm256_load_ps(intersection.t2), t1,
+                                            _mm256_cmp_ps(t1, registers.tMin, _CMP_GE_OQ));
+                __m256 accept = _mm256_and_ps(HitLanes(intersection.hitMask),
+                                              _mm256_and_ps(_mm256_cmp_ps(t, registers.tMin, _CMP_GE_OQ),
+                                                            _mm256_cmp_ps(t, closest, _CMP_LE_OQ)));
+                closest = _mm256_blendv_ps(closest, t, accept);
+                closestSphere = _mm256_blendv_epi8(closestSphere, _mm256_set1_epi32(static_cast<int>(i)),
+                                                   _mm256_castps_si256(accept));
+                found = _mm256_or_ps(found, accept);
+            }
+        }
+
+        alignas(32) float t[RayPacket8::Size];
+        alignas(32) std::uint32_t sphere[RayPacket8::Size];
+        _mm256_store_ps(t, closest);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(sphere), closestSphere);
+        const int foundMask = _mm256_movemask_ps(found) & registers.active;
+        for (int lane = 0; lane < RayPacket8::Size; ++lane)
+        {
+            if ((foundMask & (1 << lane)) != 0)
+            {
+                hits[lane].hit = true;
+                hits[lane].t = t[lane];
+                hits[lane].primitive = primitiveIndices[sphere[lane]];
+                spheres[sphere[lane]].CompleteHit(packet.rays.Get(lane), hits[lane]);
+            }
+        }
+#else
+        for (int lane = 0; lane < RayPacket8::Size; ++lane)
+        {
+            if (packet.Active(lane))
+            {
+                hits[lane] = ClosestHit(TraversalRay{packet.rays.Get(lane), packet.tMin[lane], packet.tMax[lane]});
+            }
+        }
+#endif
+    }
+
+    int BvhView::Occluded(const TraversalPacket8& packet) const
+    {
+        if (nodes.empty())
+        {
+            return 0;
+        }
+
+        int occluded = 0;
+#if defined(RAYTRACER_SIMD_AVX2)
+        const PacketRegisters registers{packet};
+        int remaining = registers.active;
+        if (remaining == 0)
+        {
+            return 0;
+        }
+
+        std::uint32_t stack[MaxDepth + 1];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            std::uint32_t nodeIndex = stack[--stackSize];
+            const BvhNode& node = nodes[nodeIndex];
+            const int active = IntersectNode8(node, registers, registers.tMax) & remaining;
+            if (active == 0)
+            {
+                continue;
+            }
+
+            if (!node.IsLeaf())
+            {
+                PushChildren(node, nodeIndex, registers, active, stack, stackSize);
+                continue;
+            }
+
+            for (std::uint32_t i = node.offset; i < node.offset + node.count; ++i)
+            {
+                Sphere::PacketIntersection intersection = spheres[i].Intersect(packet.rays);
+                if ((intersection.hitMask & remaining) == 0)
+                {
+                    continue;
+                }
+                auto inside = [&](const float* roots) {
+                    __m256 t = _mm256_load_ps(roots);
+                    return _mm256_and_ps(_mm256_cmp_ps(t, registers.tMin, _CMP_GE_OQ),
+                                         _mm256_cmp_ps(t, registers.tMax, _CMP_LE_OQ));
+                };
+                __m256 blocked = _mm256_and_ps(HitLanes(intersection.hitMask),
+                                               _mm256_or_ps(inside(intersection.t1), inside(intersection.t2)));
+                occluded |= _mm256_movemask_ps(blocked) & remaining;
+                remaining &= ~occluded;
+                if (remaining == 0)
+                {
+                    return occluded;
+                }
+            }
+        }
+#else
+        for (int lane = 0; lane < RayPacket8::Size; ++lane)
+        {
+            if (packet.Active(lane) &&
+                Occluded(TraversalRay{packet.rays.Get(lane), packet.tMin[lane], packet.tMax[lane]}))
+            {
+                occluded |= 1 << lane;
+            }
+        }
+#endif
+        return occluded;
+    }
+}
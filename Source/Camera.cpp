@@ -0,0 +1,144 @@
+#include "RayTracer/Camera.hpp"
+#include "RayTracer/Simd.hpp"
+#include "RayTracer/Vector4.hpp"
+
+#include <algorithm>
+
+namespace RayTracer
+{
+    namespace
+    {
+        // Only directions are taken from the projection, so the depth range just has to be well conditioned.
+        constexpr float Near = 0.1f;
+        constexpr float Far = 100.0f;
+
+        Vector3 Unproject(const Matrix& inverseViewProjection, float ndcX, float ndcY)
+        {
+            Vector4 point = inverseViewProjection * Vector4{ndcX, ndcY, -1.0f, 1.0f};
+            return Vector3{point.x, point.y, point.z} / point.w;
+        }
+    }
+
+    Camera::Camera(const Vector3& eye, const Vector3& target, const Vector3& up, float verticalFov, int width,
+                   int height)
+        : eye{eye}
+        , inverseViewProjection{
+              (Matrix::LookAt(eye, target, up) *
+               Matrix::Perspective(verticalFov, static_cast<float>(width) / static_cast<float>(height), Near, Far))
+                  .Inverse()}
+        , width{width}
+        , height{height}
+    {
+        // Points on the near plane, which is flat in world space, so the direction is affine in NDC and therefore
+        // in pixel coordinates.
+        Vector3 center = Unproject(inverseViewProjection, 0.0f, 0.0f);
+        Vector3 right = Unproject(inverseViewProjection, 1.0f, 0.0f) - center;
+        Vector3 upwards = Unproject(inverseViewProjection, 0.0f, 1.0f) - center;
+
+        // NDC x = 2 px / width - 1 and NDC y = 1 - 2 py / height.
+        stepX = right * (2.0f / static_cast<float>(width));
+        stepY = upwards * (-2.0f / static_cast<float>(height));
+        corner = center - eye - right + upwards;
+    }
+
+    Ray Camera::GenerateRay(float x, float y) const
+    {
+        return Ray{eye, corner + stepX * x + stepY * y};
+    }
+
+    void Camera::GenerateRays(const Tile& tile, const Vector3Arrays& directions) const
+    {
+        for (int row = 0; row < tile.height; ++row)
+        {
+            std::size_t offset = static_cast<std::size_t>(row) * static_cast<std::size_t>(tile.width);
+            GenerateRow(tile.x, tile.y + row, tile.width, directions.x.data() + offset, directions.y.data() + offset,
+                        directions.z.data() + offset);
+        }
+    }
+
+    void Camera::GeneratePackets(const Tile& tile, std::span<RayPacket8> packets) const
+    {
+        const int packetsPerRow = PacketsPerRow(tile);
+        for (int row = 0; row < tile.height; ++row)
+        {
+            for (int p = 0; p < packetsPerRow; ++p)
+            {
+                RayPacket8& packet = packets[static_cast<std::size_t>(row * packetsPerRow + p)];
+                int x = tile.x + p * RayPacket8::Size;
+                int count = std::min(RayPacket8::Size, tile.x + tile.width - x);
+                GenerateRow(x, tile.y + row, count, packet.directionX, packet.directionY, packet.directionZ);
+                for (int lane = 0; lane < RayPacket8::Size; ++lane)
+                {
+                    packet.originX[lane] = eye.x;
+                    packet.originY[lane] = eye.y;
+                    packet.originZ[lane] = eye.z;
+                }
+                for (int lane = count; lane < RayPacket8::Size; ++lane)
+                {
+                    packet.directionX[lane] = packet.directionX[count - 1];
+                    packet.directionY[lane] = packet.directionY[count - 1];
+                    packet.directionZ[lane] = packet.directionZ[count - 1];
+                }
+            }
+        }
+    }
+
+    void Camera::GenerateRow(int x, int y, int count, float* directionX, float* directionY, float* directionZ) const
+    {
+        // Direction through the center of the first pixel.
+        const float py = static_cast<float>(y) + 0.5f;
+        const Vector3 rowStart = corner + stepY * py + stepX * (static_cast<float>(x) + 0.5f);
+
+        int i = 0;
+#if defined(RAYTRACER_SIMD_AVX2)
+        const __m256 lanes = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+        const __m256 startX = _mm256_set1_ps(rowStart.x);
+        const __m256 startY = _mm256_set1_ps(rowStart.y);
+        const __m256 startZ = _mm256_set1_ps(rowStart.z);
+        const __m256 stepXX = _mm256_set1_ps(stepX.x);
+        const __m256 stepXY = _mm256_set1_ps(stepX.y);
+        const __m256 stepXZ = _mm256_set1_ps(stepX.z);
+        const __m256 one = _mm256_set1_ps(1.0f);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 offset = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(i)), lanes);
+            __m256 dx = _mm256_fmadd_ps(offset, stepXX, startX);
+            __m256 dy = _mm256_fmadd_ps(offset, stepXY, startY);
+            __m256 dz = _mm256_fmadd_ps(offset, stepXZ, startZ);
+            __m256 lengthSquared = _mm256_fmadd_ps(dz, dz, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dx, dx)));
+            __m256 inverseLength = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSquared));
+            _mm256_storeu_ps(directionX + i, _mm256_mul_ps(dx, inverseLength));
+            _mm256_storeu_ps(directionY + i, _mm256_mul_ps(dy, inverseLength));
+            _mm256_storeu_ps(directionZ + i, _mm256_mul_ps(dz, inverseLength));
+        }
+#elif defined(RAYTRACER_SIMD_SSE4)
+        const __m128 lanes = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+        const __m128 startX = _mm_set1_ps(rowStart.x);
+        const __m128 startY = _mm_set1_ps(rowStart.y);
+        const __m128 startZ = _mm_set1_ps(rowStart.z);
+        const __m128 stepXX = _mm_set1_ps(stepX.x);
+        const __m128 stepXY = _mm_set1_ps(stepX.y);
+        const __m128 stepXZ = _mm_set1_ps(stepX.z);
+        const __m128 one = _mm_set1_ps(1.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 offset = _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), lanes);
+            __m128 dx = _mm_add_ps(_mm_mul_ps(offset, stepXX), startX);
+            __m128 dy = _mm_add_ps(_mm_mul_ps(offset, stepXY), startY);
+            __m128 dz = _mm_add_ps(_mm_mul_ps(offset, stepXZ), startZ);
+            __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            __m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+            _mm_storeu_ps(directionX + i, _mm_mul_ps(dx, inverseLength));
+            _mm_storeu_ps(directionY + i, _mm_mul_ps(dy, inverseLength));
+            _mm_storeu_ps(directionZ + i, _mm_mul_ps(dz, inverseLength));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            Vector3 direction = (rowStart + stepX * static_cast<float>(i)).Normalized();
+            directionX[i] = direction.x;
+            directionY[i] = direction.y;
+            directionZ[i] = direction.z;
+        }
+    }
+}
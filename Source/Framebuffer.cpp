@@ -0,0 +1,22 @@
+#include "RayTracer/Framebuffer.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace RayTracer
+{
+    Framebuffer::Framebuffer(int width, int height)
+        : width{width}
+        , height{height}
+    {
+        // Round the row length up to the smallest pixel count that fills whole cache lines.
+        std::size_t pixelsPerLine = CacheLineSize / std::gcd(CacheLineSize, sizeof(Color));
+        stride = (static_cast<std::size_t>(width) + pixelsPerLine - 1) / pixelsPerLine * pixelsPerLine;
+        pixels.resize(stride * static_cast<std::size_t>(height));
+    }
+
+    void Framebuffer::Clear(const Color& color)
+    {
+        std::fill(pixels.begin(), pixels.end(), color);
+    }
+}
@@ -0,0 +1,82 @@
+#include "RayTracer/ImageWriter.hpp"
+
+#include <bit>
+#include <cstring>
+#include <string>
+
+namespace RayTracer
+{
+    ImageWriter::ImageWriter(std::ostream& stream, ImageFormat format, int width, int height,
+                             const ToneMapper::Settings& toneMap)
+        : stream{stream}
+        , format{format}
+        , width{width}
+        , height{height}
+        , rowFinished(static_cast<std::size_t>(height), false)
+        , toneMapper{toneMap}
+    {
+        std::string header;
+        if (format == ImageFormat::Ppm)
+        {
+            header = "P6\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n";
+            rowBuffer.resize(static_cast<std::size_t>(width) * 3);
+            encodedRow.resize(static_cast<std::size_t>(width));
+        }
+        else
+        {
+            // A negative scale marks little endian data.
+            const char* scale = std::endian::native == std::endian::little ? "-1.0" : "1.0";
+            header = "PF\n" + std::to_string(width) + " " + std::to_string(height) + "\n" + scale + "\n";
+            rowBuffer.resize(static_cast<std::size_t>(width) * 3 * sizeof(float));
+        }
+        stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+    }
+
+    void ImageWriter::WriteRows(const Framebuffer& framebuffer, int firstRow, int rowCount)
+    {
+        for (int row = firstRow; row < firstRow + rowCount; ++row)
+        {
+            rowFinished[row] = true;
+        }
+        while (nextFileRow < height && rowFinished[ImageRow(nextFileRow)])
+        {
+            WriteRow(framebuffer, ImageRow(nextFileRow));
+            ++nextFileRow;
+        }
+    }
+
+    ImageFormat ImageWriter::FormatFromPath(const std::filesystem::path& path)
+    {
+        return path.extension() == ".pfm" ? ImageFormat::Pfm : ImageFormat::Ppm;
+    }
+
+    void ImageWriter::WriteRow(const Framebuffer& framebuffer, int row)
+    {
+        std::span<const Color> pixels = framebuffer.Row(row);
+        if (format == ImageFormat::Ppm)
+        {
+            toneMapper.ConvertRow(pixels, encodedRow);
+            for (int x = 0; x < width; ++x)
+            {
+                rowBuffer[3 * x + 0] = static_cast<char>(Rgba8Channel(encodedRow[x], 0));
+                rowBuffer[3 * x + 1] = static_cast<char>(Rgba8Channel(encodedRow[x], 1));
+                rowBuffer[3 * x + 2] = static_cast<char>(Rgba8Channel(encodedRow[x], 2));
+            }
+        }
+        else
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const float values[3] = {pixels[x].r, pixels[x].g, pixels[x].b};
+                std::memcpy(rowBuffer.data() + sizeof(values) * x, values, sizeof(values));
+            }
+        }
+        stream.write(rowBuffer.data(), static_cast<std::streamsize>(rowBuffer.size()));
+    }
+
+    int ImageWriter::ImageRow(int fileRow) const
+    {
+        // PFM stores rows bottom to top.
+        return format == ImageFormat::Pfm ? height - 1 - fileRow : fileRow;
+    }
+}
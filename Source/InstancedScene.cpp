@@ -0,0 +1,204 @@
+#include "RayTracer/InstancedScene.hpp"
+
+#include <utility>
+
+namespace RayTracer
+{
+    namespace
+    {
+        /**
+         * A world space ray moved into the object space of an instance. The object space direction is renormalized,
+         * so distances along it are the world space ones multiplied by scale.
+         */
+        struct ObjectRay
+        {
+            TraversalRay ray;
+            float scale;
+        };
+
+        ObjectRay ToObjectSpace(const Instance& instance, const TraversalRay& ray, float tMax)
+        {
+            Vector3 origin = instance.transform.InverseTransformPoint(ray.ray.origin);
+            Vector3 direction = instance.transform.InverseTransformVector(ray.ray.direction);
+            float scale = direction.Length();
+            return {TraversalRay{Ray{origin, direction / scale, UnitDirection}, ray.tMin * scale, tMax * scale}, scale};
+        }
+
+        Aabb WorldBounds(const Aabb& objectBounds, const Transform& transform)
+        {
+            Aabb bounds;
+            for (int corner = 0; corner < 8; ++corner)
+            {
+                Vector3 point{(corner & 1) ? objectBounds.max.x : objectBounds.min.x,
+                              (corner & 2) ? objectBounds.max.y : objectBounds.min.y,
+                              (corner & 4) ? objectBounds.max.z : objectBounds.min.z};
+                bounds.Expand(transform.TransformPoint(point));
+            }
+            return bounds;
+        }
+    }
+
+    InstancedScene::InstancedScene(std::vector<Bvh> geometries, std::vector<Instance> instances)
+        : geometries{std::move(geometries)}
+        , instances{std::move(instances)}
+    {
+        // Instances of empty geometries can never be hit and are left out of the top level tree.
+        std::vector<Aabb> bounds;
+        std::vector<std::uint32_t> boundedInstances;
+        bounds.reserve(this->instances.size());
+        boundedInstances.reserve(this->instances.size());
+        for (std::uint32_t i = 0; i < this->instances.size(); ++i)
+        {
+            const Instance& instance = this->instances[i];
+            Aabb objectBounds = this->geometries[instance.geometry].Bounds();
+            if (!objectBounds.IsEmpty())
+            {
+                bounds.push_back(WorldBounds(objectBounds, instance.transform));
+                boundedInstances.push_back(i);
+            }
+        }
+
+        nodes = Bvh::Build(bounds, instanceIndices);
+        for (std::uint32_t& index : instanceIndices)
+        {
+            index = boundedInstances[index];
+        }
+    }
+
+    Hit InstancedScene::ClosestHit(const TraversalRay& ray) const
+    {
+        Hit result;
+        if (nodes.empty())
+        {
+            return result;
+        }
+
+        float closest = ray.tMax;
+
+        struct StackEntry
+        {
+            std::uint32_t node;
+            float tEntry;
+        };
+        StackEntry stack[Bvh::MaxDepth];
+        int stackSize = 0;
+
+        float tEntry;
+        if (!nodes[0].Intersect(ray, closest, tEntry))
+        {
+            return result;
+        }
+        stack[stackSize++] = {0, tEntry};
+
+        while (stackSize > 0)
+        {
+            StackEntry entry = stack[--stackSize];
+            if (entry.tEntry > closest)
+            {
+                continue;
+            }
+
+            std::uint32_t nodeIndex = entry.node;
+            while (true)
+            {
+                const BvhNode& node = nodes[nodeIndex];
+                if (node.IsLeaf())
+                {
+                    for (std::uint32_t i = node.offset; i < node.offset + node.count; ++i)
+                    {
+                        const Instance& instance = instances[instanceIndices[i]];
+                        ObjectRay objectRay = ToObjectSpace(instance, ray, closest);
+                        Hit hit = geometries[instance.geometry].ClosestHit(objectRay.ray);
+                        if (hit.hit)
+                        {
+                            closest = hit.t / objectRay.scale;
+                            result = hit;
+                            result.t = closest;
+                            result.instance = instanceIndices[i];
+                        }
+                    }
+                    break;
+                }
+
+                // Visit the child on the near side of the split plane first.
+                std::uint32_t nearChild = nodeIndex + 1;
+                std::uint32_t farChild = node.offset;
+                if (ray.sign[node.axis] != 0)
+                {
+                    std::swap(nearChild, farChild);
+                }
+
+                float tNear;
+                float tFar;
+                bool hitNear = nodes[nearChild].Intersect(ray, closest, tNear);
+                bool hitFar = nodes[farChild].Intersect(ray, closest, tFar);
+                if (hitNear && hitFar)
+                {
+                    stack[stackSize++] = {farChild, tFar};
+                    nodeIndex = nearChild;
+                }
+                else if (hitNear)
+                {
+                    nodeIndex = nearChild;
+                }
+                else if (hitFar)
+                {
+                    nodeIndex = farChild;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        if (result.hit)
+        {
+            // The object space normal goes back through the inverse-transpose, which does not keep it unit length.
+            result.position = ray.ray.At(result.t);
+            result.normal = instances[result.instance].transform.TransformNormal(result.normal).Normalized();
+        }
+        return result;
+    }
+
+    bool InstancedScene::Occluded(const TraversalRay& ray) const
+    {
+        if (nodes.empty())
+        {
+            return false;
+        }
+
+        std::uint32_t stack[Bvh::MaxDepth + 1];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        float tEntry;
+        while (stackSize > 0)
+        {
+            std::uint32_t nodeIndex = stack[--stackSize];
+            const BvhNode& node = nodes[nodeIndex];
+            if (!node.Intersect(ray, ray.tMax, tEntry))
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                for (std::uint32_t i = node.offset; i < node.offset + node.count; ++i)
+                {
+                    const Instance& instance = instances[instanceIndices[i]];
+                    if (geometries[instance.geometry].Occluded(ToObjectSpace(instance, ray, ray.tMax).ray))
+                    {
+                        return true;
+                    }
+                }
+            }
+            else
+            {
+                stack[stackSize++] = node.offset;
+                stack[stackSize++] = nodeIndex + 1;
+            }
+        }
+        return false;
+    }
+}
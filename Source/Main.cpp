@@ -1,8 +1,109 @@
+#include "RayTracer/Bvh.hpp"
+#include "RayTracer/Camera.hpp"
+#include "RayTracer/Framebuffer.hpp"
+#include "RayTracer/ImageWriter.hpp"
+#include "RayTracer/Renderer.hpp"
+#include "RayTracer/ThreadPool.hpp"
+#include "RayTracer/ToneMap.hpp"
+#include "RayTracer/Wavefront.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <print>
+#include <vector>
+
+using namespace RayTracer;
+
+namespace
+{
+    constexpr int Width = 640;
+    constexpr int Height = 360;
+    constexpr float FieldOfView = 1.0f;
+
+    std::vector<Sphere> BuildScene()
+    {
+        std::vector<Sphere> spheres;
+        spheres.push_back({{0.0f, -1003.0f, 0.0f}, 1000.0f});
+        for (int z = 0; z < 10; ++z)
+        {
+            for (int x = -10; x <= 10; ++x)
+            {
+                float radius = 0.3f + 0.1f * static_cast<float>((x + z) % 3);
+                spheres.push_back({{static_cast<float>(x), radius - 3.0f, -static_cast<float>(z) * 2.0f}, radius});
+            }
+        }
+        return spheres;
+    }
+
+    /**
+     * The ground uses material 0, the other spheres cycle through the remaining three.
+     */
+    std::vector<std::uint32_t> MaterialIds(std::size_t sphereCount)
+    {
+        std::vector<std::uint32_t> ids(sphereCount, 0);
+        for (std::size_t i = 1; i < sphereCount; ++i)
+        {
+            ids[i] = 1 + static_cast<std::uint32_t>(i % 3);
+        }
+        return ids;
+    }
+}
 
-int main()
+int main(int argc, char** argv)
 {
-    std::println("Hello, World!");
+    const std::filesystem::path outputPath = argc > 1 ? argv[1] : "render.ppm";
+    std::ofstream output{outputPath, std::ios::binary};
+    if (!output)
+    {
+        std::println(stderr, "Cannot open {} for writing", outputPath.string());
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Sphere> spheres = BuildScene();
+    Bvh bvh{spheres};
+    Framebuffer framebuffer{Width, Height};
+    // The lights are bright enough to clip highlights, which the filmic curve rolls off instead.
+    ImageWriter writer{output, ImageWriter::FormatFromPath(outputPath), Width, Height, {1.0f, ToneMapOperator::Aces}};
+
+    // Camera at +z looking down -z, matching the right-handed coordinate system.
+    const Vector3 eye{0.0f, 0.0f, 8.0f};
+    const Camera camera{eye, eye + Vector3{0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}, FieldOfView, Width, Height};
+
+    ThreadPool pool;
+    Renderer renderer{pool};
+    WavefrontIntegrator::Settings settings;
+    settings.materials = {Material::Lambert({0.6f, 0.6f, 0.55f}),
+                          Material::Lambert({0.8f, 0.3f, 0.2f}),
+                          Material::BlinnPhong({0.2f, 0.4f, 0.8f}, {0.5f, 0.5f, 0.5f}, 64.0f),
+                          Material::BlinnPhong({0.7f, 0.7f, 0.2f}, {0.3f, 0.3f, 0.3f}, 16.0f)};
+    settings.materialIds = MaterialIds(spheres.size());
+    settings.lights = {Light::Directional({0.5f, 1.0f, 0.3f}, {2.0f, 1.9f, 1.7f}),
+                       Light::Point({-4.0f, 2.0f, 2.0f}, {20.0f, 16.0f, 12.0f})};
+    settings.pixelOrder = renderer.Order();
+    const WavefrontIntegrator integrator{camera, settings};
+    auto renderTile = [&](const Tile& tile, unsigned worker) {
+        integrator.RenderTile(bvh, tile, renderer.Scratch(worker), framebuffer);
+    };
+    auto writeRows = [&](int firstRow, int rowCount) { writer.WriteRows(framebuffer, firstRow, rowCount); };
+    RenderStats stats = renderer.Render(Width, Height, renderTile, writeRows);
+
+    output.close();
+    if (!output)
+    {
+        std::println(stderr, "Failed to write {}", outputPath.string());
+        return EXIT_FAILURE;
+    }
+
+    std::println("Rendered {}x{} to {} with {} threads in {:.2f} ms", Width, Height, outputPath.string(),
+                 pool.ThreadCount(), std::chrono::duration<double, std::milli>(stats.wall).count());
+    for (unsigned worker = 0; worker < stats.workers.size(); ++worker)
+    {
+        std::println("  thread {:3}: {:5.1f}% busy, {} tiles, {} stolen", worker, 100.0 * stats.Utilization(worker),
+                     stats.workers[worker].tasks, stats.workers[worker].steals);
+    }
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,122 @@
+#include "RayTracer/MappedFile.hpp"
+
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace RayTracer
+{
+    MappedFile::~MappedFile()
+    {
+        Unmap();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : data{std::exchange(other.data, nullptr)}
+        , size{std::exchange(other.size, 0)}
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Unmap();
+            data = std::exchange(other.data, nullptr);
+            size = std::exchange(other.size, 0);
+        }
+        return *this;
+    }
+
+    std::expected<MappedFile, MappedFile::Error> MappedFile::Open(const std::filesystem::path& path)
+    {
+#if defined(_WIN32)
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return std::unexpected{Error::CannotOpen};
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            return std::unexpected{Error::CannotOpen};
+        }
+        std::size_t size = static_cast<std::size_t>(fileSize.QuadPart);
+        if (size == 0)
+        {
+            // Empty files cannot be mapped.
+            CloseHandle(file);
+            return MappedFile{};
+        }
+
+        // The view keeps the mapping and the file alive, so both handles can be closed right away.
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return std::unexpected{Error::CannotMap};
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr)
+        {
+            return std::unexpected{Error::CannotMap};
+        }
+        return MappedFile{static_cast<const std::byte*>(view), size};
+#else
+        int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+        {
+            return std::unexpected{Error::CannotOpen};
+        }
+        struct stat status;
+        if (::fstat(file, &status) != 0)
+        {
+            ::close(file);
+            return std::unexpected{Error::CannotOpen};
+        }
+        std::size_t size = static_cast<std::size_t>(status.st_size);
+        if (size == 0)
+        {
+            // Empty files cannot be mapped.
+            ::close(file);
+            return MappedFile{};
+        }
+
+        // The mapping keeps the file alive, so the descriptor can be closed right away.
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+        ::close(file);
+        if (mapping == MAP_FAILED)
+        {
+            return std::unexpected{Error::CannotMap};
+        }
+        return MappedFile{static_cast<const std::byte*>(mapping), size};
+#endif
+    }
+
+    void MappedFile::Unmap()
+    {
+        if (data == nullptr)
+        {
+            return;
+        }
+#if defined(_WIN32)
+        UnmapViewOfFile(data);
+#else
+        ::munmap(const_cast<std::byte*>(data), size);
+#endif
+        data = nullptr;
+        size = 0;
+    }
+}
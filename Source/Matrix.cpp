@@ -1,6 +1,9 @@
 #include "RayTracer/Matrix.hpp"
+#include "RayTracer/ThreadPool.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace RayTracer
 {
@@ -22,15 +25,105 @@ namespace RayTracer
         return det;
     }
 
+#if defined(RAYTRACER_SIMD_SSE4)
+    namespace
+    {
+        // A 2x2 block is held in one register as (m00, m01, m10, m11). The formulas are written for row-major blocks,
+        // but they invert the transpose just as well, so they also apply directly to the column-major storage.
+        template <int X, int Y, int Z, int W>
+        __m128 Swizzle(__m128 v)
+        {
+            return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        template <int X, int Y, int Z, int W>
+        __m128 Shuffle(__m128 a, __m128 b)
+        {
+            return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        // A * B
+        __m128 Block2Multiply(__m128 a, __m128 b)
+        {
+            return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+                              _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+
+        // adj(A) * B
+        __m128 Block2AdjugateMultiply(__m128 a, __m128 b)
+        {
+            return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+                              _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+        }
+
+        // A * adj(B)
+        __m128 Block2MultiplyAdjugate(__m128 a, __m128 b)
+        {
+            return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+                              _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+    }
+
     Matrix Matrix::Inverse() const
     {
-        float det = Determinant();
-        if (std::fabsf(det) < std::numeric_limits<float>::epsilon())
+        // Block inverse of M = |A B; C D| with 2x2 blocks, where
+        //   |M| = |A||D| + |B||C| - tr(adj(A) B adj(D) C)
+        //   M^-1 = 1/|M| * |adj(X) adj(Y); adj(Z) adj(W)| with
+        //   X = |D|A - B adj(D) C, Y = |B|C - D adj(adj(A) B), Z = |C|B - A adj(adj(D) C), W = |A|D - C adj(A) B.
+        __m128 column0 = _mm_load_ps(Column(0));
+        __m128 column1 = _mm_load_ps(Column(1));
+        __m128 column2 = _mm_load_ps(Column(2));
+        __m128 column3 = _mm_load_ps(Column(3));
+
+        __m128 a = _mm_movelh_ps(column0, column1);
+        __m128 b = _mm_movehl_ps(column1, column0);
+        __m128 c = _mm_movelh_ps(column2, column3);
+        __m128 d = _mm_movehl_ps(column3, column2);
+
+        // (|A|, |B|, |C|, |D|)
+        __m128 blockDeterminants =
+            _mm_sub_ps(_mm_mul_ps(Shuffle<0, 2, 0, 2>(column0, column2), Shuffle<1, 3, 1, 3>(column1, column3)),
+                       _mm_mul_ps(Shuffle<1, 3, 1, 3>(column0, column2), Shuffle<0, 2, 0, 2>(column1, column3)));
+        __m128 detA = Swizzle<0, 0, 0, 0>(blockDeterminants);
+        __m128 detB = Swizzle<1, 1, 1, 1>(blockDeterminants);
+        __m128 detC = Swizzle<2, 2, 2, 2>(blockDeterminants);
+        __m128 detD = Swizzle<3, 3, 3, 3>(blockDeterminants);
+
+        __m128 adjDC = Block2AdjugateMultiply(d, c);
+        __m128 adjAB = Block2AdjugateMultiply(a, b);
+        __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Block2Multiply(b, adjDC));
+        __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Block2Multiply(c, adjAB));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Block2MultiplyAdjugate(d, adjAB));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Block2MultiplyAdjugate(a, adjDC));
+
+        __m128 trace = _mm_mul_ps(adjAB, Swizzle<0, 2, 1, 3>(adjDC));
+        trace = _mm_hadd_ps(trace, trace);
+        trace = _mm_hadd_ps(trace, trace);
+        __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+        if (std::fabsf(_mm_cvtss_f32(det)) < std::numeric_limits<float>::epsilon())
         {
             // Singular matrix, return identity or handle error
             return Identity();
         }
 
+        // The adjugate of each block is applied by the sign pattern here and the shuffles on store.
+        __m128 inverseDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+        x = _mm_mul_ps(x, inverseDet);
+        y = _mm_mul_ps(y, inverseDet);
+        z = _mm_mul_ps(z, inverseDet);
+        w = _mm_mul_ps(w, inverseDet);
+
+        Matrix inv;
+        _mm_store_ps(inv.Column(0), Shuffle<3, 1, 3, 1>(x, y));
+        _mm_store_ps(inv.Column(1), Shuffle<2, 0, 2, 0>(x, y));
+        _mm_store_ps(inv.Column(2), Shuffle<3, 1, 3, 1>(z, w));
+        _mm_store_ps(inv.Column(3), Shuffle<2, 0, 2, 0>(z, w));
+        return inv;
+    }
+#else
+    Matrix Matrix::Inverse() const
+    {
         Matrix inv;
         float m[16];
         for (int i = 0; i < 16; ++i)
@@ -73,10 +166,191 @@ namespace RayTracer
         inv.elements[15] = m[0] * (m[5] * m[10] - m[6] * m[9]) - m[1] * (m[4] * m[10] - m[6] * m[8]) +
                            m[2] * (m[4] * m[9] - m[5] * m[8]);
 
+        // Laplace expansion along the first column, reusing the cofactors instead of a separate Determinant().
+        float det = m[0] * inv.elements[0] + m[1] * inv.elements[4] + m[2] * inv.elements[8] + m[3] * inv.elements[12];
+        if (std::fabsf(det) < std::numeric_limits<float>::epsilon())
+        {
+            // Singular matrix, return identity or handle error
+            return Identity();
+        }
+
+        float inverseDet = 1.0f / det;
         for (int i = 0; i < 16; ++i)
         {
-            inv.elements[i] /= det;
+            inv.elements[i] *= inverseDet;
         }
         return inv;
     }
+#endif
+
+    namespace
+    {
+        // Elements per task of the parallel batch transforms, large enough to amortize scheduling.
+        constexpr std::size_t ParallelChunkSize = 16384;
+
+        template <bool Translate>
+        void TransformArray(const Matrix& m, const Vector3* in, Vector3* out, std::size_t count)
+        {
+            std::size_t i = 0;
+#if defined(RAYTRACER_SIMD_SSE4)
+            // The w lanes of the columns are cleared so that the padding of the results stays zero.
+            __m128 column0 = Simd::ClearW(_mm_load_ps(m.Column(0)));
+            __m128 column1 = Simd::ClearW(_mm_load_ps(m.Column(1)));
+            __m128 column2 = Simd::ClearW(_mm_load_ps(m.Column(2)));
+            __m128 column3 = Translate ? Simd::ClearW(_mm_load_ps(m.Column(3))) : _mm_setzero_ps();
+#if defined(RAYTRACER_SIMD_AVX2)
+            // A padded Vector3 is 16 bytes, so two of them fill a 256-bit register.
+            __m256 column0Pair = _mm256_set_m128(column0, column0);
+            __m256 column1Pair = _mm256_set_m128(column1, column1);
+            __m256 column2Pair = _mm256_set_m128(column2, column2);
+            __m256 column3Pair = _mm256_set_m128(column3, column3);
+            for (; i + 2 <= count; i += 2)
+            {
+                __m256 v = _mm256_loadu_ps(&in[i].x);
+                __m256 sum = _mm256_fmadd_ps(column0Pair, _mm256_permute_ps(v, 0x00), column3Pair);
+                sum = _mm256_fmadd_ps(column1Pair, _mm256_permute_ps(v, 0x55), sum);
+                sum = _mm256_fmadd_ps(column2Pair, _mm256_permute_ps(v, 0xAA), sum);
+                _mm256_storeu_ps(&out[i].x, _mm256_blend_ps(sum, _mm256_setzero_ps(), 0x88));
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                __m128 v = in[i].Load();
+                __m128 sum = _mm_add_ps(column3, _mm_mul_ps(column0, _mm_shuffle_ps(v, v, 0x00)));
+                sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_shuffle_ps(v, v, 0x55)));
+                sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_shuffle_ps(v, v, 0xAA)));
+                out[i] = Vector3{sum};
+            }
+#else
+            const float* e = m.elements;
+            for (; i < count; ++i)
+            {
+                Vector3 v = in[i];
+                Vector3 result{e[0] * v.x + e[4] * v.y + e[8] * v.z, e[1] * v.x + e[5] * v.y + e[9] * v.z,
+                               e[2] * v.x + e[6] * v.y + e[10] * v.z};
+                if constexpr (Translate)
+                {
+                    result = result + Vector3{e[12], e[13], e[14]};
+                }
+                out[i] = result;
+            }
+#endif
+        }
+
+        template <bool Translate>
+        void TransformArrays(const Matrix& m, const ConstVector3Arrays& in, const Vector3Arrays& out,
+                             std::size_t begin, std::size_t end)
+        {
+            const float* e = m.elements;
+            const float translation[3] = {Translate ? e[12] : 0.0f, Translate ? e[13] : 0.0f,
+                                          Translate ? e[14] : 0.0f};
+            std::size_t i = begin;
+#if defined(RAYTRACER_SIMD_AVX2)
+            for (; i + 8 <= end; i += 8)
+            {
+                __m256 x = _mm256_loadu_ps(&in.x[i]);
+                __m256 y = _mm256_loadu_ps(&in.y[i]);
+                __m256 z = _mm256_loadu_ps(&in.z[i]);
+                float* outputs[3] = {&out.x[i], &out.y[i], &out.z[i]};
+                for (int r = 0; r < 3; ++r)
+                {
+                    __m256 sum = _mm256_fmadd_ps(_mm256_set1_ps(e[r]), x, _mm256_set1_ps(translation[r]));
+                    sum = _mm256_fmadd_ps(_mm256_set1_ps(e[r + 4]), y, sum);
+                    sum = _mm256_fmadd_ps(_mm256_set1_ps(e[r + 8]), z, sum);
+                    _mm256_storeu_ps(outputs[r], sum);
+                }
+            }
+#elif defined(RAYTRACER_SIMD_SSE4)
+            for (; i + 4 <= end; i += 4)
+            {
+                __m128 x = _mm_loadu_ps(&in.x[i]);
+                __m128 y = _mm_loadu_ps(&in.y[i]);
+                __m128 z = _mm_loadu_ps(&in.z[i]);
+                float* outputs[3] = {&out.x[i], &out.y[i], &out.z[i]};
+                for (int r = 0; r < 3; ++r)
+                {
+                    __m128 sum = _mm_add_ps(_mm_set1_ps(translation[r]), _mm_mul_ps(_mm_set1_ps(e[r]), x));
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(e[r + 4]), y));
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(e[r + 8]), z));
+                    _mm_storeu_ps(outputs[r], sum);
+                }
+            }
+#endif
+            for (; i < end; ++i)
+            {
+                float x = in.x[i];
+                float y = in.y[i];
+                float z = in.z[i];
+                out.x[i] = e[0] * x + e[4] * y + e[8] * z + translation[0];
+                out.y[i] = e[1] * x + e[5] * y + e[9] * z + translation[1];
+                out.z[i] = e[2] * x + e[6] * y + e[10] * z + translation[2];
+            }
+        }
+
+        std::size_t ArrayCount(const ConstVector3Arrays& in, const Vector3Arrays& out)
+        {
+            return std::min({in.x.size(), in.y.size(), in.z.size(), out.x.size(), out.y.size(), out.z.size()});
+        }
+
+        template <typename Function>
+        void ParallelChunks(ThreadPool& pool, std::size_t count, const Function& function)
+        {
+            if (count <= ParallelChunkSize || pool.ThreadCount() <= 1)
+            {
+                function(0, count);
+                return;
+            }
+            std::size_t chunks = (count + ParallelChunkSize - 1) / ParallelChunkSize;
+            pool.ParallelFor(chunks, [&](std::size_t chunk) {
+                std::size_t begin = chunk * ParallelChunkSize;
+                function(begin, std::min(begin + ParallelChunkSize, count));
+            });
+        }
+    }
+
+    void Matrix::TransformPoints(std::span<const Vector3> in, std::span<Vector3> out) const
+    {
+        TransformArray<true>(*this, in.data(), out.data(), std::min(in.size(), out.size()));
+    }
+
+    void Matrix::TransformPoints(const ConstVector3Arrays& in, const Vector3Arrays& out) const
+    {
+        TransformArrays<true>(*this, in, out, 0, ArrayCount(in, out));
+    }
+
+    void Matrix::TransformDirections(std::span<const Vector3> in, std::span<Vector3> out) const
+    {
+        TransformArray<false>(*this, in.data(), out.data(), std::min(in.size(), out.size()));
+    }
+
+    void Matrix::TransformDirections(const ConstVector3Arrays& in, const Vector3Arrays& out) const
+    {
+        TransformArrays<false>(*this, in, out, 0, ArrayCount(in, out));
+    }
+
+    void Matrix::TransformPoints(ThreadPool& pool, std::span<const Vector3> in, std::span<Vector3> out) const
+    {
+        ParallelChunks(pool, std::min(in.size(), out.size()), [&](std::size_t begin, std::size_t end) {
+            TransformArray<true>(*this, in.data() + begin, out.data() + begin, end - begin);
+        });
+    }
+
+    void Matrix::TransformPoints(ThreadPool& pool, const ConstVector3Arrays& in, const Vector3Arrays& out) const
+    {
+        ParallelChunks(pool, ArrayCount(in, out),
+                       [&](std::size_t begin, std::size_t end) { TransformArrays<true>(*this, in, out, begin, end); });
+    }
+
+    void Matrix::TransformDirections(ThreadPool& pool, std::span<const Vector3> in, std::span<Vector3> out) const
+    {
+        ParallelChunks(pool, std::min(in.size(), out.size()), [&](std::size_t begin, std::size_t end) {
+            TransformArray<false>(*this, in.data() + begin, out.data() + begin, end - begin);
+        });
+    }
+
+    void Matrix::TransformDirections(ThreadPool& pool, const ConstVector3Arrays& in, const Vector3Arrays& out) const
+    {
+        ParallelChunks(pool, ArrayCount(in, out),
+                       [&](std::size_t begin, std::size_t end) { TransformArrays<false>(*this, in, out, begin, end); });
+    }
 }
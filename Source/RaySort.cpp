@@ -0,0 +1,75 @@
+#include "RayTracer/RaySort.hpp"
+
+#include <array>
+
+namespace RayTracer
+{
+    namespace
+    {
+        // 10 bit digits keep the histogram in the L1 cache and sort a RaySortKey in three passes.
+        constexpr int DigitBits = 10;
+        constexpr std::uint32_t DigitCount = 1u << DigitBits;
+    }
+
+    RaySortKey::RaySortKey(const Aabb& bounds)
+        : minimum{bounds.min}
+    {
+        constexpr float Cells = static_cast<float>(1 << OriginBits);
+        Vector3 extent = bounds.Extent();
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            // Flat or empty bounds put every origin in the first cell of that axis.
+            scale[axis] = extent[axis] > 0.0f ? Cells / extent[axis] : 0.0f;
+        }
+        if (bounds.IsEmpty())
+        {
+            minimum = {0.0f, 0.0f, 0.0f};
+        }
+    }
+
+    void RadixSort(std::span<std::uint32_t> keys, std::span<std::uint32_t> values, std::span<std::uint32_t> keyScratch,
+                   std::span<std::uint32_t> valueScratch, int keyBits)
+    {
+        const std::size_t count = keys.size();
+        std::span<std::uint32_t> sourceKeys = keys;
+        std::span<std::uint32_t> sourceValues = values;
+        std::span<std::uint32_t> targetKeys = keyScratch.first(count);
+        std::span<std::uint32_t> targetValues = valueScratch.first(count);
+
+        std::array<std::uint32_t, DigitCount> offsets;
+        for (int shift = 0; shift < keyBits; shift += DigitBits)
+        {
+            offsets.fill(0);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                ++offsets[(sourceKeys[i] >> shift) & (DigitCount - 1)];
+            }
+            if (count == 0 || offsets[(sourceKeys[0] >> shift) & (DigitCount - 1)] == count)
+            {
+                continue;
+            }
+
+            std::uint32_t sum = 0;
+            for (std::uint32_t& offset : offsets)
+            {
+                std::uint32_t digitCount = offset;
+                offset = sum;
+                sum += digitCount;
+            }
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::uint32_t target = offsets[(sourceKeys[i] >> shift) & (DigitCount - 1)]++;
+                targetKeys[target] = sourceKeys[i];
+                targetValues[target] = sourceValues[i];
+            }
+            std::swap(sourceKeys, targetKeys);
+            std::swap(sourceValues, targetValues);
+        }
+
+        if (sourceKeys.data() != keys.data())
+        {
+            std::copy(sourceKeys.begin(), sourceKeys.end(), keys.begin());
+            std::copy(sourceValues.begin(), sourceValues.end(), values.begin());
+        }
+    }
+}
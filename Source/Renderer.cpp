@@ -0,0 +1,84 @@
+#include "RayTracer/Renderer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace RayTracer
+{
+    Renderer::Renderer(ThreadPool& pool, int tileSize, PixelOrder order)
+        : pool{pool}
+        , tileSize{tileSize}
+        , order{order}
+    {
+        // One arena per worker and one for a calling thread outside the pool, which renders tiles too.
+        arenas.reserve(pool.ThreadCount() + 1);
+        for (unsigned worker = 0; worker <= pool.ThreadCount(); ++worker)
+        {
+            arenas.push_back(std::make_unique<Arena>());
+        }
+    }
+
+    RenderStats Renderer::Render(int width, int height, const TileFunction& renderTile, const RowsFunction& rowsDone)
+    {
+        RenderStats stats;
+        // The pool may be shared, so its statistics are compared instead of reset.
+        const std::vector<ThreadPool::WorkerStats> before = pool.Stats();
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<Tile> tiles = SplitTiles(width, height, tileSize, order);
+        int tilesPerBand = (width + tileSize - 1) / tileSize;
+        std::vector<std::atomic<int>> remainingInBand((height + tileSize - 1) / tileSize);
+        for (auto& remaining : remainingInBand)
+        {
+            remaining.store(tilesPerBand, std::memory_order_relaxed);
+        }
+        std::mutex rowsMutex;
+
+        // Written only by the thread of each worker index, and read after ParallelFor has returned.
+        stats.workers.resize(arenas.size());
+        pool.ParallelFor(tiles.size(), [&](std::size_t index, unsigned worker) {
+            auto tileStart = std::chrono::steady_clock::now();
+            const Tile& tile = tiles[index];
+            renderTile(tile, worker);
+            arenas[worker]->Reset();
+            if (rowsDone && remainingInBand[tile.y / tileSize].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::lock_guard lock{rowsMutex};
+                rowsDone(tile.y, tile.height);
+            }
+            stats.workers[worker].busy += std::chrono::steady_clock::now() - tileStart;
+            ++stats.workers[worker].tasks;
+        });
+
+        stats.wall = std::chrono::steady_clock::now() - start;
+        const std::vector<ThreadPool::WorkerStats> after = pool.Stats();
+        for (std::size_t worker = 0; worker < before.size(); ++worker)
+        {
+            stats.workers[worker].steals = after[worker].steals - before[worker].steals;
+        }
+        return stats;
+    }
+
+    std::vector<Tile> Renderer::SplitTiles(int width, int height, int tileSize, PixelOrder order)
+    {
+        std::vector<Tile> tiles;
+        for (int y = 0; y < height; y += tileSize)
+        {
+            for (int x = 0; x < width; x += tileSize)
+            {
+                tiles.push_back({x, y, std::min(tileSize, width - x), std::min(tileSize, height - y)});
+            }
+        }
+
+        if (order == PixelOrder::Morton)
+        {
+            auto code = [tileSize](const Tile& tile) {
+                return MortonEncode(static_cast<std::uint32_t>(tile.x / tileSize),
+                                    static_cast<std::uint32_t>(tile.y / tileSize));
+            };
+            std::sort(tiles.begin(), tiles.end(), [&](const Tile& a, const Tile& b) { return code(a) < code(b); });
+        }
+        return tiles;
+    }
+}
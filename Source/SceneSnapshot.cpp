@@ -0,0 +1,331 @@
+#include "RayTracer/SceneSnapshot.hpp"
+#include "RayTracer/Simd.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace RayTracer
+{
+    namespace
+    {
+        constexpr char Magic[8] = {'R', 'T', 'S', 'C', 'E', 'N', 'E', '\0'};
+        constexpr std::uint32_t ByteOrderMark = 0x01020304;
+
+        enum class SectionId
+        {
+            CenterX,
+            CenterY,
+            CenterZ,
+            Radius,
+            BvhNodes,
+            BvhPrimitiveIndices,
+            BvhSpheres,
+            Instances,
+        };
+
+        constexpr int SectionCount = static_cast<int>(SectionId::Instances) + 1;
+
+        // Indexed by SectionId.
+        constexpr std::uint64_t ElementSize[SectionCount] = {
+            sizeof(float),
+            sizeof(float),
+            sizeof(float),
+            sizeof(float),
+            sizeof(BvhNode),
+            sizeof(std::uint32_t),
+            sizeof(Sphere),
+            sizeof(Instance),
+        };
+
+        struct SectionEntry
+        {
+            // Byte offset from the start of the file and size in bytes.
+            std::uint64_t offset;
+            std::uint64_t size;
+        };
+
+        struct Header
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t byteOrder;
+            // Layout of the build that wrote the file, which must match the reading build exactly.
+            std::uint32_t sphereSize;
+            std::uint32_t instanceSize;
+            std::uint32_t nodeSize;
+            std::uint32_t vectorAlignment;
+            std::uint64_t fileSize;
+            std::uint64_t sphereCount;
+            SectionEntry sections[SectionCount];
+        };
+
+        // Sections are used in place, so everything stored must be valid as raw bytes.
+        static_assert(std::is_trivially_copyable_v<BvhNode>);
+        static_assert(std::is_trivially_copyable_v<Sphere>);
+        static_assert(std::is_trivially_copyable_v<Instance>);
+        static_assert(std::is_trivially_copyable_v<Header>);
+
+        std::uint64_t AlignUp(std::uint64_t offset)
+        {
+            return (offset + SceneSnapshot::SectionAlignment - 1) / SceneSnapshot::SectionAlignment *
+                   SceneSnapshot::SectionAlignment;
+        }
+
+        const SectionEntry& Entry(const Header& header, SectionId section)
+        {
+            return header.sections[static_cast<int>(section)];
+        }
+
+        Header ReadHeader(const std::byte* data)
+        {
+            Header header;
+            std::memcpy(&header, data, sizeof(header));
+            return header;
+        }
+
+        template <typename T>
+        std::span<const T> SectionData(const std::byte* data, const Header& header, SectionId section)
+        {
+            const SectionEntry& entry = Entry(header, section);
+            return {reinterpret_cast<const T*>(data + entry.offset), static_cast<std::size_t>(entry.size / sizeof(T))};
+        }
+
+        /**
+         * Checks the BVH in one pass over the nodes, so that traversal of a damaged file stays inside the sections
+         * and inside its fixed size stack: leaves reference spheres that exist, children come after their parent in
+         * the array, which also rules out cycles, and no node is deeper than BvhView::MaxDepth. Depths are propagated
+         * forward, so every parent has been seen before its children.
+         */
+        bool ValidateHierarchy(const std::byte* data, const Header& header)
+        {
+            std::span<const BvhNode> nodes = SectionData<BvhNode>(data, header, SectionId::BvhNodes);
+            std::span<const std::uint32_t> primitiveIndices =
+                SectionData<std::uint32_t>(data, header, SectionId::BvhPrimitiveIndices);
+            const std::uint64_t sphereCount = primitiveIndices.size();
+
+            std::vector<std::uint8_t> depth(nodes.size(), 0);
+            for (std::size_t i = 0; i < nodes.size(); ++i)
+            {
+                const BvhNode& node = nodes[i];
+                if (node.IsLeaf())
+                {
+                    if (static_cast<std::uint64_t>(node.offset) + node.count > sphereCount)
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                if (node.axis > 2 || node.offset <= i || node.offset >= nodes.size() || i + 1 >= nodes.size() ||
+                    depth[i] >= BvhView::MaxDepth)
+                {
+                    return false;
+                }
+                std::uint8_t childDepth = static_cast<std::uint8_t>(depth[i] + 1);
+                depth[i + 1] = std::max(depth[i + 1], childDepth);
+                depth[node.offset] = std::max(depth[node.offset], childDepth);
+            }
+
+            for (std::uint32_t index : primitiveIndices)
+            {
+                if (index >= sphereCount)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * A snapshot stores a single geometry, the BVH, so every instance must refer to geometry 0.
+         */
+        bool ValidateInstances(const std::byte* data, const Header& header)
+        {
+            for (const Instance& instance : SectionData<Instance>(data, header, SectionId::Instances))
+            {
+                if (instance.geometry != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::optional<SnapshotError> Validate(const std::byte* data, std::size_t size)
+        {
+            if (size < sizeof(Header))
+            {
+                return SnapshotError::NotASnapshot;
+            }
+            Header header = ReadHeader(data);
+            if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0)
+            {
+                return SnapshotError::NotASnapshot;
+            }
+            if (header.byteOrder != ByteOrderMark)
+            {
+                return SnapshotError::LayoutMismatch;
+            }
+            if (header.version != SceneSnapshot::Version)
+            {
+                return SnapshotError::UnsupportedVersion;
+            }
+            if (header.sphereSize != sizeof(Sphere) || header.instanceSize != sizeof(Instance) ||
+                header.nodeSize != sizeof(BvhNode) || header.vectorAlignment != Simd::VectorAlignment)
+            {
+                return SnapshotError::LayoutMismatch;
+            }
+            if (header.fileSize != size)
+            {
+                return SnapshotError::Corrupt;
+            }
+
+            for (int s = 0; s < SectionCount; ++s)
+            {
+                const SectionEntry& entry = header.sections[s];
+                if (entry.offset % SceneSnapshot::SectionAlignment != 0 || entry.offset < sizeof(Header) ||
+                    entry.offset > size || entry.size > size - entry.offset || entry.size % ElementSize[s] != 0)
+                {
+                    return SnapshotError::Corrupt;
+                }
+            }
+
+            // The SoA arrays are swept in blocks of SphereSoA::Width, so they must all share the padded length.
+            std::uint64_t paddedBytes = Entry(header, SectionId::CenterX).size;
+            for (SectionId section : {SectionId::CenterY, SectionId::CenterZ, SectionId::Radius})
+            {
+                if (Entry(header, section).size != paddedBytes)
+                {
+                    return SnapshotError::Corrupt;
+                }
+            }
+            std::uint64_t padded = paddedBytes / sizeof(float);
+            if (padded % SphereSoA::Width != 0 || header.sphereCount > padded)
+            {
+                return SnapshotError::Corrupt;
+            }
+
+            std::uint64_t bvhSpheres = Entry(header, SectionId::BvhSpheres).size / sizeof(Sphere);
+            bool hasNodes = Entry(header, SectionId::BvhNodes).size != 0;
+            if (Entry(header, SectionId::BvhPrimitiveIndices).size / sizeof(std::uint32_t) != bvhSpheres ||
+                hasNodes != (bvhSpheres != 0))
+            {
+                return SnapshotError::Corrupt;
+            }
+            if (!ValidateHierarchy(data, header) || !ValidateInstances(data, header))
+            {
+                return SnapshotError::Corrupt;
+            }
+            return std::nullopt;
+        }
+    }
+
+    void SceneSnapshot::Write(std::ostream& stream, const SphereSoAView& spheres, const BvhView& bvh,
+                              std::span<const Instance> instances)
+    {
+        const std::uint64_t soaBytes = spheres.PaddedSize() * sizeof(float);
+        const void* sources[SectionCount] = {
+            spheres.CenterX(),
+            spheres.CenterY(),
+            spheres.CenterZ(),
+            spheres.Radius(),
+            bvh.Nodes().data(),
+            bvh.PrimitiveIndices().data(),
+            bvh.Spheres().data(),
+            instances.data(),
+        };
+        const std::uint64_t sizes[SectionCount] = {
+            soaBytes,
+            soaBytes,
+            soaBytes,
+            soaBytes,
+            bvh.Nodes().size_bytes(),
+            bvh.PrimitiveIndices().size_bytes(),
+            bvh.Spheres().size_bytes(),
+            instances.size_bytes(),
+        };
+
+        Header header{};
+        std::memcpy(header.magic, Magic, sizeof(Magic));
+        header.version = Version;
+        header.byteOrder = ByteOrderMark;
+        header.sphereSize = sizeof(Sphere);
+        header.instanceSize = sizeof(Instance);
+        header.nodeSize = sizeof(BvhNode);
+        header.vectorAlignment = static_cast<std::uint32_t>(Simd::VectorAlignment);
+        header.sphereCount = spheres.Size();
+
+        std::uint64_t offset = AlignUp(sizeof(Header));
+        for (int s = 0; s < SectionCount; ++s)
+        {
+            header.sections[s] = {offset, sizes[s]};
+            offset = AlignUp(offset + sizes[s]);
+        }
+        header.fileSize = offset;
+
+        static constexpr char Padding[SectionAlignment] = {};
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        std::uint64_t position = sizeof(header);
+        for (int s = 0; s < SectionCount; ++s)
+        {
+            stream.write(Padding, static_cast<std::streamsize>(header.sections[s].offset - position));
+            stream.write(static_cast<const char*>(sources[s]), static_cast<std::streamsize>(sizes[s]));
+            position = header.sections[s].offset + sizes[s];
+        }
+        stream.write(Padding, static_cast<std::streamsize>(header.fileSize - position));
+    }
+
+    std::expected<SceneSnapshot, SnapshotError> SceneSnapshot::Open(const std::filesystem::path& path)
+    {
+        auto file = MappedFile::Open(path);
+        if (!file)
+        {
+            return std::unexpected{file.error() == MappedFile::Error::CannotOpen ? SnapshotError::CannotOpen
+                                                                                 : SnapshotError::CannotMap};
+        }
+        if (std::optional<SnapshotError> error = Validate(file->Data(), file->Size()))
+        {
+            return std::unexpected{*error};
+        }
+        return SceneSnapshot{std::move(*file)};
+    }
+
+    template <typename T>
+    std::span<const T> SceneSnapshot::Section(int section) const
+    {
+        if (file.Data() == nullptr)
+        {
+            return {};
+        }
+        const SectionEntry& entry = ReadHeader(file.Data()).sections[section];
+        return {reinterpret_cast<const T*>(file.Data() + entry.offset), entry.size / sizeof(T)};
+    }
+
+    SphereSoAView SceneSnapshot::Spheres() const
+    {
+        std::span<const float> centerX = Section<float>(static_cast<int>(SectionId::CenterX));
+        std::size_t count = file.Data() == nullptr ? 0 : ReadHeader(file.Data()).sphereCount;
+        return {count,
+                centerX.size(),
+                centerX.data(),
+                Section<float>(static_cast<int>(SectionId::CenterY)).data(),
+                Section<float>(static_cast<int>(SectionId::CenterZ)).data(),
+                Section<float>(static_cast<int>(SectionId::Radius)).data()};
+    }
+
+    BvhView SceneSnapshot::Hierarchy() const
+    {
+        return {Section<BvhNode>(static_cast<int>(SectionId::BvhNodes)),
+                Section<std::uint32_t>(static_cast<int>(SectionId::BvhPrimitiveIndices)),
+                Section<Sphere>(static_cast<int>(SectionId::BvhSpheres))};
+    }
+
+    std::span<const Instance> SceneSnapshot::Instances() const
+    {
+        return Section<Instance>(static_cast<int>(SectionId::Instances));
+    }
+}
@@ -0,0 +1,158 @@
+#include "RayTracer/Shading.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+
+namespace RayTracer
+{
+    namespace
+    {
+        void SampleLightScalar(const SurfaceBatch& surfaces, std::span<const Material> materials, const Light& light,
+                               const LightSamples& samples, std::size_t begin)
+        {
+            for (std::size_t i = begin; i < surfaces.material.size(); ++i)
+            {
+                Vector3 toLight = light.vector;
+                float distance = std::numeric_limits<float>::infinity();
+                Color irradiance = light.color;
+                if (light.type == LightType::Point)
+                {
+                    Vector3 offset = light.vector - Vector3{surfaces.position.x[i], surfaces.position.y[i],
+                                                            surfaces.position.z[i]};
+                    float squaredDistance = offset.Dot(offset);
+                    distance = std::sqrt(squaredDistance);
+                    toLight = offset / distance;
+                    irradiance = irradiance / squaredDistance;
+                }
+
+                Vector3 normal{surfaces.normal.x[i], surfaces.normal.y[i], surfaces.normal.z[i]};
+                Vector3 view{surfaces.view.x[i], surfaces.view.y[i], surfaces.view.z[i]};
+                Color radiance = materials[surfaces.material[i]].Reflect(normal, view, toLight) * irradiance;
+
+                samples.toLight.x[i] = toLight.x;
+                samples.toLight.y[i] = toLight.y;
+                samples.toLight.z[i] = toLight.z;
+                samples.distance[i] = distance;
+                samples.r[i] = radiance.r;
+                samples.g[i] = radiance.g;
+                samples.b[i] = radiance.b;
+            }
+        }
+
+#if defined(RAYTRACER_SIMD_AVX2)
+        __m256 Dot(__m256 ax, __m256 ay, __m256 az, __m256 bx, __m256 by, __m256 bz)
+        {
+            return _mm256_fmadd_ps(ax, bx, _mm256_fmadd_ps(ay, by, _mm256_mul_ps(az, bz)));
+        }
+
+        /**
+         * Shades the points in groups of eight and returns how many were shaded. Mirrors Material::Reflect lane by
+         * lane, with the specular power evaluated as exp2(shininess * log2(x)).
+         */
+        std::size_t SampleLight8(const SurfaceBatch& surfaces, std::span<const Material> materials, const Light& light,
+                                 const LightSamples& samples)
+        {
+            constexpr int Stride = sizeof(Material) / sizeof(float);
+            constexpr int DiffuseOffset = offsetof(Material, diffuse) / sizeof(float);
+            constexpr int SpecularOffset = offsetof(Material, specular) / sizeof(float);
+            constexpr int ShininessOffset = offsetof(Material, shininess) / sizeof(float);
+            const float* table = reinterpret_cast<const float*>(materials.data());
+
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 invPi = _mm256_set1_ps(std::numbers::inv_pi_v<float>);
+            const __m256 specularScale = _mm256_set1_ps(0.125f * std::numbers::inv_pi_v<float>);
+            const __m256 eight = _mm256_set1_ps(8.0f);
+            const __m256 lightX = _mm256_set1_ps(light.vector.x);
+            const __m256 lightY = _mm256_set1_ps(light.vector.y);
+            const __m256 lightZ = _mm256_set1_ps(light.vector.z);
+            const __m256 colorR = _mm256_set1_ps(light.color.r);
+            const __m256 colorG = _mm256_set1_ps(light.color.g);
+            const __m256 colorB = _mm256_set1_ps(light.color.b);
+            const bool point = light.type == LightType::Point;
+
+            const std::size_t count = surfaces.material.size();
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                __m256 toLightX = lightX;
+                __m256 toLightY = lightY;
+                __m256 toLightZ = lightZ;
+                __m256 distance = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+                __m256 irradianceR = colorR;
+                __m256 irradianceG = colorG;
+                __m256 irradianceB = colorB;
+                if (point)
+                {
+                    __m256 offsetX = _mm256_sub_ps(lightX, _mm256_loadu_ps(&surfaces.position.x[i]));
+                    __m256 offsetY = _mm256_sub_ps(lightY, _mm256_loadu_ps(&surfaces.position.y[i]));
+                    __m256 offsetZ = _mm256_sub_ps(lightZ, _mm256_loadu_ps(&surfaces.position.z[i]));
+                    __m256 squaredDistance = Dot(offsetX, offsetY, offsetZ, offsetX, offsetY, offsetZ);
+                    distance = _mm256_sqrt_ps(squaredDistance);
+                    __m256 inverseDistance = _mm256_div_ps(_mm256_set1_ps(1.0f), distance);
+                    toLightX = _mm256_mul_ps(offsetX, inverseDistance);
+                    toLightY = _mm256_mul_ps(offsetY, inverseDistance);
+                    toLightZ = _mm256_mul_ps(offsetZ, inverseDistance);
+                    __m256 falloff = _mm256_div_ps(_mm256_set1_ps(1.0f), squaredDistance);
+                    irradianceR = _mm256_mul_ps(irradianceR, falloff);
+                    irradianceG = _mm256_mul_ps(irradianceG, falloff);
+                    irradianceB = _mm256_mul_ps(irradianceB, falloff);
+                }
+
+                __m256 normalX = _mm256_loadu_ps(&surfaces.normal.x[i]);
+                __m256 normalY = _mm256_loadu_ps(&surfaces.normal.y[i]);
+                __m256 normalZ = _mm256_loadu_ps(&surfaces.normal.z[i]);
+                __m256 cosine = _mm256_max_ps(Dot(normalX, normalY, normalZ, toLightX, toLightY, toLightZ), zero);
+
+                __m256 halfwayX = _mm256_add_ps(toLightX, _mm256_loadu_ps(&surfaces.view.x[i]));
+                __m256 halfwayY = _mm256_add_ps(toLightY, _mm256_loadu_ps(&surfaces.view.y[i]));
+                __m256 halfwayZ = _mm256_add_ps(toLightZ, _mm256_loadu_ps(&surfaces.view.z[i]));
+                __m256 squaredLength = Dot(halfwayX, halfwayY, halfwayZ, halfwayX, halfwayY, halfwayZ);
+                __m256 inverseLength = _mm256_div_ps(
+                    _mm256_set1_ps(1.0f),
+                    _mm256_sqrt_ps(_mm256_max_ps(squaredLength, _mm256_set1_ps(std::numeric_limits<float>::min()))));
+                __m256 normalHalfway =
+                    _mm256_mul_ps(Dot(normalX, normalY, normalZ, halfwayX, halfwayY, halfwayZ), inverseLength);
+                normalHalfway = _mm256_and_ps(normalHalfway, _mm256_cmp_ps(squaredLength, zero, _CMP_GT_OQ));
+
+                __m256i index = _mm256_mullo_epi32(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&surfaces.material[i])),
+                    _mm256_set1_epi32(Stride));
+                __m256 diffuseR = _mm256_i32gather_ps(table + DiffuseOffset, index, 4);
+                __m256 diffuseG = _mm256_i32gather_ps(table + DiffuseOffset + 1, index, 4);
+                __m256 diffuseB = _mm256_i32gather_ps(table + DiffuseOffset + 2, index, 4);
+                __m256 specularR = _mm256_i32gather_ps(table + SpecularOffset, index, 4);
+                __m256 specularG = _mm256_i32gather_ps(table + SpecularOffset + 1, index, 4);
+                __m256 specularB = _mm256_i32gather_ps(table + SpecularOffset + 2, index, 4);
+                __m256 shininess = _mm256_i32gather_ps(table + ShininessOffset, index, 4);
+
+                __m256 lobe = _mm256_mul_ps(Simd::PowUnit(normalHalfway, shininess),
+                                            _mm256_mul_ps(_mm256_add_ps(shininess, eight), specularScale));
+                __m256 brdfR = _mm256_fmadd_ps(specularR, lobe, _mm256_mul_ps(diffuseR, invPi));
+                __m256 brdfG = _mm256_fmadd_ps(specularG, lobe, _mm256_mul_ps(diffuseG, invPi));
+                __m256 brdfB = _mm256_fmadd_ps(specularB, lobe, _mm256_mul_ps(diffuseB, invPi));
+
+                _mm256_storeu_ps(&samples.toLight.x[i], toLightX);
+                _mm256_storeu_ps(&samples.toLight.y[i], toLightY);
+                _mm256_storeu_ps(&samples.toLight.z[i], toLightZ);
+                _mm256_storeu_ps(&samples.distance[i], distance);
+                _mm256_storeu_ps(&samples.r[i], _mm256_mul_ps(_mm256_mul_ps(brdfR, cosine), irradianceR));
+                _mm256_storeu_ps(&samples.g[i], _mm256_mul_ps(_mm256_mul_ps(brdfG, cosine), irradianceG));
+                _mm256_storeu_ps(&samples.b[i], _mm256_mul_ps(_mm256_mul_ps(brdfB, cosine), irradianceB));
+            }
+            return i;
+        }
+#endif
+    }
+
+    void SampleLight(const SurfaceBatch& surfaces, std::span<const Material> materials, const Light& light,
+                     const LightSamples& samples)
+    {
+        std::size_t begin = 0;
+#if defined(RAYTRACER_SIMD_AVX2)
+        begin = SampleLight8(surfaces, materials, light, samples);
+#endif
+        SampleLightScalar(surfaces, materials, light, samples, begin);
+    }
+}
@@ -1,4 +1,5 @@
 #include "RayTracer/Sphere.hpp"
+#include "RayTracer/Simd.hpp"
 
 #include <cmath>
 #include <utility>
@@ -39,4 +40,103 @@ namespace RayTracer
         }
         return inter;
     }
+
+    bool Sphere::Intersect(const Ray& ray, float tMin, float tMax, float& t) const
+    {
+        Vector3 oc = ray.origin - center;
+        float b = oc.Dot(ray.direction);
+        float c = oc.Dot(oc) - radius * radius;
+        float discriminant = b * b - c;
+        if (discriminant < 0.0f)
+        {
+            return false;
+        }
+        float sqrtD = std::sqrtf(discriminant);
+        float root = -b - sqrtD;
+        if (root < tMin)
+        {
+            root = -b + sqrtD;
+            if (root < tMin)
+            {
+                return false;
+            }
+        }
+        if (root > tMax)
+        {
+            return false;
+        }
+        t = root;
+        return true;
+    }
+
+    bool Sphere::Occluded(const Ray& ray, float tMin, float tMax) const
+    {
+        // Half-b form of the quadratic with a = 1, whose roots -b -+ sqrt(b^2 - c) are already in ascending order.
+        Vector3 oc = ray.origin - center;
+        float b = oc.Dot(ray.direction);
+        float c = oc.Dot(oc) - radius * radius;
+        float discriminant = b * b - c;
+        if (discriminant < 0.0f)
+        {
+            return false;
+        }
+        float sqrtD = std::sqrtf(discriminant);
+        float tNear = -b - sqrtD;
+        if (tNear >= tMin && tNear <= tMax)
+        {
+            return true;
+        }
+        float tFar = -b + sqrtD;
+        return tFar >= tMin && tFar <= tMax;
+    }
+
+    Sphere::PacketIntersection Sphere::Intersect(const RayPacket8& packet) const
+    {
+        PacketIntersection result;
+#if defined(RAYTRACER_SIMD_AVX2)
+        // Same quadratic as the single ray version, evaluated for all eight lanes at once.
+        __m256 ocX = _mm256_sub_ps(_mm256_load_ps(packet.originX), _mm256_set1_ps(center.x));
+        __m256 ocY = _mm256_sub_ps(_mm256_load_ps(packet.originY), _mm256_set1_ps(center.y));
+        __m256 ocZ = _mm256_sub_ps(_mm256_load_ps(packet.originZ), _mm256_set1_ps(center.z));
+        __m256 dX = _mm256_load_ps(packet.directionX);
+        __m256 dY = _mm256_load_ps(packet.directionY);
+        __m256 dZ = _mm256_load_ps(packet.directionZ);
+
+        __m256 a = _mm256_fmadd_ps(dZ, dZ, _mm256_fmadd_ps(dY, dY, _mm256_mul_ps(dX, dX)));
+        __m256 b = _mm256_fmadd_ps(ocZ, dZ, _mm256_fmadd_ps(ocY, dY, _mm256_mul_ps(ocX, dX)));
+        b = _mm256_add_ps(b, b);
+        __m256 c = _mm256_fmadd_ps(ocZ, ocZ, _mm256_fmadd_ps(ocY, ocY, _mm256_mul_ps(ocX, ocX)));
+        c = _mm256_sub_ps(c, _mm256_set1_ps(radius * radius));
+        __m256 discriminant = _mm256_fmsub_ps(b, b, _mm256_mul_ps(_mm256_set1_ps(4.0f), _mm256_mul_ps(a, c)));
+
+        __m256 zero = _mm256_setzero_ps();
+        __m256 valid = _mm256_cmp_ps(discriminant, zero, _CMP_GE_OQ);
+        __m256 sqrtD = _mm256_sqrt_ps(_mm256_max_ps(discriminant, zero));
+        __m256 twoA = _mm256_add_ps(a, a);
+        __m256 negB = _mm256_sub_ps(zero, b);
+        __m256 root1 = _mm256_div_ps(_mm256_sub_ps(negB, sqrtD), twoA);
+        __m256 root2 = _mm256_div_ps(_mm256_add_ps(negB, sqrtD), twoA);
+        __m256 tNear = _mm256_min_ps(root1, root2);
+        __m256 tFar = _mm256_max_ps(root1, root2);
+
+        __m256 hit = _mm256_and_ps(valid, _mm256_cmp_ps(tFar, zero, _CMP_GE_OQ));
+        __m256 t1 = _mm256_blendv_ps(tFar, tNear, _mm256_cmp_ps(tNear, zero, _CMP_GE_OQ));
+
+        result.hitMask = _mm256_movemask_ps(hit);
+        _mm256_store_ps(result.t1, _mm256_and_ps(hit, t1));
+        _mm256_store_ps(result.t2, _mm256_and_ps(hit, tFar));
+#else
+        for (int lane = 0; lane < RayPacket8::Size; ++lane)
+        {
+            RayIntersection inter = Intersect(packet.Get(lane));
+            if (inter.hit)
+            {
+                result.hitMask |= 1 << lane;
+                result.t1[lane] = inter.t1;
+                result.t2[lane] = inter.t2;
+            }
+        }
+#endif
+        return result;
+    }
 }
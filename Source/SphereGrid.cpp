@@ -0,0 +1,389 @@
+#include "RayTracer/SphereGrid.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+namespace RayTracer
+{
+    namespace
+    {
+        constexpr float Infinity = std::numeric_limits<float>::infinity();
+
+        /**
+         * Splits [0, count) into one contiguous range per thread and runs function(thread, begin, end) on each.
+         */
+        template <typename Function>
+        void ParallelFor(std::size_t count, unsigned threadCount, const Function& function)
+        {
+            threadCount = static_cast<unsigned>(std::min<std::size_t>(threadCount, count));
+            if (threadCount <= 1)
+            {
+                function(0u, std::size_t{0}, count);
+                return;
+            }
+
+            std::vector<std::jthread> threads;
+            threads.reserve(threadCount);
+            std::size_t chunk = (count + threadCount - 1) / threadCount;
+            for (unsigned t = 0; t < threadCount; ++t)
+            {
+                std::size_t begin = t * chunk;
+                std::size_t end = std::min(count, begin + chunk);
+                if (begin < end)
+                {
+                    threads.emplace_back([&function, t, begin, end] { function(t, begin, end); });
+                }
+            }
+        }
+
+        void SetupLevel(SphereGrid::Level& level, const Aabb& bounds, std::size_t primitiveCount, float density,
+                        int maxResolution)
+        {
+            level.bounds = bounds;
+            Vector3 extent = bounds.Extent();
+            float maxExtent = std::max({extent.x, extent.y, extent.z});
+
+            // Pick cells of roughly equal size in all axes, so that the grid holds density * primitiveCount cells.
+            float volume = extent.x * extent.y * extent.z;
+            float cells = density * static_cast<float>(primitiveCount);
+            float cellsPerUnit = 0.0f;
+            if (volume > 0.0f)
+            {
+                cellsPerUnit = std::cbrt(cells / volume);
+            }
+            else if (maxExtent > 0.0f)
+            {
+                cellsPerUnit = cells / maxExtent;
+            }
+
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                int resolution = static_cast<int>(extent[axis] * cellsPerUnit);
+                level.resolution[axis] = std::clamp(resolution, 1, maxResolution);
+                level.cellSize[axis] = extent[axis] / static_cast<float>(level.resolution[axis]);
+                level.inverseCellSize[axis] = level.cellSize[axis] > 0.0f ? 1.0f / level.cellSize[axis] : 0.0f;
+            }
+        }
+
+        int CellCoordinate(const SphereGrid::Level& level, float position, int axis)
+        {
+            int cell = static_cast<int>((position - level.bounds.min[axis]) * level.inverseCellSize[axis]);
+            return std::clamp(cell, 0, level.resolution[axis] - 1);
+        }
+
+        /**
+         * Calls function(cellIndex) for every cell of the level overlapped by bounds.
+         */
+        template <typename Function>
+        void ForEachOverlappedCell(const SphereGrid::Level& level, const Aabb& bounds, const Function& function)
+        {
+            int low[3];
+            int high[3];
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                low[axis] = CellCoordinate(level, bounds.min[axis], axis);
+                high[axis] = CellCoordinate(level, bounds.max[axis], axis);
+            }
+            for (int z = low[2]; z <= high[2]; ++z)
+            {
+                for (int y = low[1]; y <= high[1]; ++y)
+                {
+                    for (int x = low[0]; x <= high[0]; ++x)
+                    {
+                        function(level.CellIndex(x, y, z));
+                    }
+                }
+            }
+        }
+
+        /**
+         * Fills the cells of a level with the spheres in primitives, as a counting sort: count references per cell,
+         * prefix sum the counts into cell offsets, then scatter. Both passes over the spheres run in parallel.
+         */
+        void FillLevel(SphereGrid::Level& level, std::span<const Sphere> spheres,
+                       std::span<const std::uint32_t> primitives, unsigned threadCount)
+        {
+            std::size_t cellCount = static_cast<std::size_t>(level.resolution[0]) * level.resolution[1] *
+                                    level.resolution[2];
+            std::vector<std::atomic<std::uint32_t>> cursors(cellCount);
+
+            ParallelFor(primitives.size(), threadCount, [&](unsigned, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    ForEachOverlappedCell(level, spheres[primitives[i]].Bounds(), [&](int cell) {
+                        cursors[cell].fetch_add(1, std::memory_order_relaxed);
+                    });
+                }
+            });
+
+            level.cellStart.resize(cellCount + 1);
+            std::uint32_t offset = 0;
+            for (std::size_t cell = 0; cell < cellCount; ++cell)
+            {
+                level.cellStart[cell] = offset;
+                offset += cursors[cell].load(std::memory_order_relaxed);
+                cursors[cell].store(level.cellStart[cell], std::memory_order_relaxed);
+            }
+            level.cellStart[cellCount] = offset;
+            level.references.resize(offset);
+
+            ParallelFor(primitives.size(), threadCount, [&](unsigned, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    ForEachOverlappedCell(level, spheres[primitives[i]].Bounds(), [&](int cell) {
+                        std::uint32_t slot = cursors[cell].fetch_add(1, std::memory_order_relaxed);
+                        level.references[slot] = primitives[i];
+                    });
+                }
+            });
+        }
+
+        /**
+         * Walks the cells of a level pierced by the ray within [tMin, tMax] in front to back order with a 3D DDA.
+         * visit(cellIndex, tEntry, tExit) returns true to stop the walk.
+         */
+        template <typename Visitor>
+        void WalkCells(const SphereGrid::Level& level, const TraversalRay& traversalRay, float tMin, float tMax,
+                       const Visitor& visit)
+        {
+            const Ray& ray = traversalRay.ray;
+            const Vector3& inverseDirection = traversalRay.inverseDirection;
+            const Vector3* bounds[2] = {&level.bounds.min, &level.bounds.max};
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                int sign = traversalRay.sign[axis];
+                float t0 = ((*bounds[sign])[axis] - ray.origin[axis]) * inverseDirection[axis];
+                float t1 = ((*bounds[1 - sign])[axis] - ray.origin[axis]) * inverseDirection[axis];
+                tMin = t0 > tMin ? t0 : tMin;
+                tMax = t1 < tMax ? t1 : tMax;
+            }
+            if (tMin > tMax)
+            {
+                return;
+            }
+
+            Vector3 entry = ray.At(tMin);
+            int cell[3];
+            int step[3];
+            int end[3];
+            float tNext[3];
+            float tDelta[3];
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                cell[axis] = CellCoordinate(level, entry[axis], axis);
+                float direction = ray.direction[axis];
+                if (direction > 0.0f)
+                {
+                    step[axis] = 1;
+                    end[axis] = level.resolution[axis];
+                    float boundary =
+                        level.bounds.min[axis] + static_cast<float>(cell[axis] + 1) * level.cellSize[axis];
+                    tNext[axis] = (boundary - ray.origin[axis]) * inverseDirection[axis];
+                    tDelta[axis] = level.cellSize[axis] * inverseDirection[axis];
+                }
+                else if (direction < 0.0f)
+                {
+                    step[axis] = -1;
+                    end[axis] = -1;
+                    float boundary = level.bounds.min[axis] + static_cast<float>(cell[axis]) * level.cellSize[axis];
+                    tNext[axis] = (boundary - ray.origin[axis]) * inverseDirection[axis];
+                    tDelta[axis] = -level.cellSize[axis] * inverseDirection[axis];
+                }
+                else
+                {
+                    step[axis] = 0;
+                    end[axis] = -1;
+                    tNext[axis] = Infinity;
+                    tDelta[axis] = Infinity;
+                }
+            }
+
+            float tEntry = tMin;
+            while (true)
+            {
+                int axis = tNext[0] < tNext[1] ? (tNext[0] < tNext[2] ? 0 : 2) : (tNext[1] < tNext[2] ? 1 : 2);
+                float tExit = std::min(tNext[axis], tMax);
+                if (visit(level.CellIndex(cell[0], cell[1], cell[2]), tEntry, tExit) || tNext[axis] > tMax)
+                {
+                    return;
+                }
+                cell[axis] += step[axis];
+                if (cell[axis] == end[axis])
+                {
+                    return;
+                }
+                tEntry = tNext[axis];
+                tNext[axis] += tDelta[axis];
+            }
+        }
+
+        void IntersectCell(const SphereGrid::Level& level, int cellIndex, std::span<const Sphere> spheres,
+                           const TraversalRay& ray, Hit& result)
+        {
+            for (std::uint32_t r = level.cellStart[cellIndex]; r < level.cellStart[cellIndex + 1]; ++r)
+            {
+                std::uint32_t primitive = level.references[r];
+                float t;
+                if (!spheres[primitive].Intersect(ray.ray, ray.tMin, result.hit ? result.t : ray.tMax, t))
+                {
+                    continue;
+                }
+                // Ties are broken by index since the parallel build leaves references in arbitrary order.
+                if (!result.hit || t < result.t || primitive < result.primitive)
+                {
+                    result.hit = true;
+                    result.t = t;
+                    result.primitive = primitive;
+                }
+            }
+        }
+    }
+
+    SphereGrid::SphereGrid(std::span<const Sphere> spheres, const SphereGridOptions& options)
+        : spheres{spheres.begin(), spheres.end()}
+    {
+        if (spheres.empty())
+        {
+            return;
+        }
+
+        unsigned threadCount = options.threadCount > 0 ? options.threadCount : std::thread::hardware_concurrency();
+        threadCount = std::max(threadCount, 1u);
+
+        std::vector<Aabb> partialBounds(threadCount);
+        ParallelFor(spheres.size(), threadCount, [&](unsigned thread, std::size_t begin, std::size_t end) {
+            Aabb bounds;
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                bounds.Expand(spheres[i].Bounds());
+            }
+            partialBounds[thread] = bounds;
+        });
+        Aabb bounds;
+        for (const Aabb& partial : partialBounds)
+        {
+            bounds.Expand(partial);
+        }
+
+        std::vector<std::uint32_t> primitives(spheres.size());
+        for (std::uint32_t i = 0; i < primitives.size(); ++i)
+        {
+            primitives[i] = i;
+        }
+
+        SetupLevel(top, bounds, spheres.size(), options.density, options.maxResolution);
+        FillLevel(top, spheres, primitives, threadCount);
+
+        if (options.subdivideThreshold == 0)
+        {
+            return;
+        }
+
+        std::size_t cellCount = top.cellStart.size() - 1;
+        subgridIndex.assign(cellCount, -1);
+        std::vector<std::uint32_t> subdividedCells;
+        for (std::size_t cell = 0; cell < cellCount; ++cell)
+        {
+            if (top.cellStart[cell + 1] - top.cellStart[cell] > options.subdivideThreshold)
+            {
+                subgridIndex[cell] = static_cast<std::int32_t>(subdividedCells.size());
+                subdividedCells.push_back(static_cast<std::uint32_t>(cell));
+            }
+        }
+
+        // Each nested grid is small, so they are built sequentially but distributed across threads.
+        subgrids.resize(subdividedCells.size());
+        ParallelFor(subdividedCells.size(), threadCount, [&](unsigned, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                std::uint32_t cell = subdividedCells[i];
+                int x = static_cast<int>(cell % top.resolution[0]);
+                int y = static_cast<int>(cell / top.resolution[0] % top.resolution[1]);
+                int z = static_cast<int>(cell / top.resolution[0] / top.resolution[1]);
+                Vector3 cellMin{top.bounds.min.x + static_cast<float>(x) * top.cellSize[0],
+                                top.bounds.min.y + static_cast<float>(y) * top.cellSize[1],
+                                top.bounds.min.z + static_cast<float>(z) * top.cellSize[2]};
+                Vector3 cellMax = cellMin + Vector3{top.cellSize[0], top.cellSize[1], top.cellSize[2]};
+
+                std::span<const std::uint32_t> cellPrimitives{top.references.data() + top.cellStart[cell],
+                                                              top.references.data() + top.cellStart[cell + 1]};
+                SetupLevel(subgrids[i], {cellMin, cellMax}, cellPrimitives.size(), options.density,
+                           options.maxResolution);
+                FillLevel(subgrids[i], this->spheres, cellPrimitives, 1);
+            }
+        });
+    }
+
+    Hit SphereGrid::ClosestHit(const TraversalRay& ray) const
+    {
+        Hit result;
+        if (spheres.empty())
+        {
+            return result;
+        }
+
+        WalkCells(top, ray, ray.tMin, ray.tMax, [&](int cellIndex, float tEntry, float tExit) {
+            if (!subgridIndex.empty() && subgridIndex[cellIndex] >= 0)
+            {
+                const Level& subgrid = subgrids[subgridIndex[cellIndex]];
+                WalkCells(subgrid, ray, tEntry, tExit,
+                          [&](int subcellIndex, float, float subcellExit) {
+                              IntersectCell(subgrid, subcellIndex, spheres, ray, result);
+                              return result.hit && result.t <= subcellExit;
+                          });
+            }
+            else
+            {
+                IntersectCell(top, cellIndex, spheres, ray, result);
+            }
+            // A hit inside this cell cannot be beaten by any cell further along the ray.
+            return result.hit && result.t <= tExit;
+        });
+        if (result.hit)
+        {
+            spheres[result.primitive].CompleteHit(ray.ray, result);
+        }
+        return result;
+    }
+
+    bool SphereGrid::Occluded(const TraversalRay& ray) const
+    {
+        if (spheres.empty())
+        {
+            return false;
+        }
+
+        // Any sphere crossed inside the interval will do, even one that extends outside the cell being visited.
+        auto occludedInCell = [&](const Level& level, int cellIndex) {
+            for (std::uint32_t r = level.cellStart[cellIndex]; r < level.cellStart[cellIndex + 1]; ++r)
+            {
+                if (spheres[level.references[r]].Occluded(ray.ray, ray.tMin, ray.tMax))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        bool occluded = false;
+        WalkCells(top, ray, ray.tMin, ray.tMax, [&](int cellIndex, float tEntry, float tExit) {
+            if (!subgridIndex.empty() && subgridIndex[cellIndex] >= 0)
+            {
+                const Level& subgrid = subgrids[subgridIndex[cellIndex]];
+                WalkCells(subgrid, ray, tEntry, tExit, [&](int subcellIndex, float, float) {
+                    occluded = occludedInCell(subgrid, subcellIndex);
+                    return occluded;
+                });
+            }
+            else
+            {
+                occluded = occludedInCell(top, cellIndex);
+            }
+            return occluded;
+        });
+        return occluded;
+    }
+}
@@ -0,0 +1,221 @@
+#include "RayTracer/SphereSoA.hpp"
+#include "RayTracer/Simd.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace RayTracer
+{
+    namespace
+    {
+        // Padding lanes get a NaN center, which makes every comparison in the intersection test fail.
+        constexpr float PaddingCenter = std::numeric_limits<float>::quiet_NaN();
+
+        std::size_t PaddedSize(std::size_t count)
+        {
+            return (count + SphereSoA::Width - 1) / SphereSoA::Width * SphereSoA::Width;
+        }
+    }
+
+    SphereSoA::SphereSoA(std::span<const Sphere> spheres)
+    {
+        Reserve(spheres.size());
+        for (const Sphere& sphere : spheres)
+        {
+            Add(sphere);
+        }
+    }
+
+    void SphereSoA::Reserve(std::size_t capacity)
+    {
+        std::size_t padded = PaddedSize(capacity);
+        centerX.reserve(padded);
+        centerY.reserve(padded);
+        centerZ.reserve(padded);
+        radius.reserve(padded);
+    }
+
+    void SphereSoA::Add(const Sphere& sphere)
+    {
+        if (count == centerX.size())
+        {
+            std::size_t padded = count + Width;
+            centerX.resize(padded, PaddingCenter);
+            centerY.resize(padded, PaddingCenter);
+            centerZ.resize(padded, PaddingCenter);
+            radius.resize(padded, 0.0f);
+        }
+        centerX[count] = sphere.center.x;
+        centerY[count] = sphere.center.y;
+        centerZ[count] = sphere.center.z;
+        radius[count] = sphere.radius;
+        ++count;
+    }
+
+    void SphereSoA::Resize(std::size_t newCount)
+    {
+        std::size_t padded = PaddedSize(newCount);
+        centerX.resize(padded);
+        centerY.resize(padded);
+        centerZ.resize(padded);
+        radius.resize(padded);
+        for (std::size_t i = count; i < newCount; ++i)
+        {
+            Set(i, Sphere{});
+        }
+        for (std::size_t i = newCount; i < padded; ++i)
+        {
+            centerX[i] = PaddingCenter;
+            centerY[i] = PaddingCenter;
+            centerZ[i] = PaddingCenter;
+            radius[i] = 0.0f;
+        }
+        count = newCount;
+    }
+
+    void SphereSoA::Clear()
+    {
+        count = 0;
+        centerX.clear();
+        centerY.clear();
+        centerZ.clear();
+        radius.clear();
+    }
+
+    Hit SphereSoAView::NearestHit(const Ray& ray) const
+    {
+#if defined(RAYTRACER_SIMD_AVX2)
+        const std::size_t padded = paddedCount;
+        const float a = ray.direction.Dot(ray.direction);
+        const __m256 originX = _mm256_set1_ps(ray.origin.x);
+        const __m256 originY = _mm256_set1_ps(ray.origin.y);
+        const __m256 originZ = _mm256_set1_ps(ray.origin.z);
+        const __m256 dirX = _mm256_set1_ps(ray.direction.x);
+        const __m256 dirY = _mm256_set1_ps(ray.direction.y);
+        const __m256 dirZ = _mm256_set1_ps(ray.direction.z);
+        const __m256 aV = _mm256_set1_ps(a);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256i step = _mm256_set1_epi32(8);
+
+        __m256 bestT = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+        __m256i bestIndex = _mm256_set1_epi32(-1);
+        __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+        for (std::size_t i = 0; i < padded; i += 8)
+        {
+            __m256 ocX = _mm256_sub_ps(originX, _mm256_load_ps(centerX + i));
+            __m256 ocY = _mm256_sub_ps(originY, _mm256_load_ps(centerY + i));
+            __m256 ocZ = _mm256_sub_ps(originZ, _mm256_load_ps(centerZ + i));
+            __m256 r = _mm256_load_ps(radius + i);
+
+            // Half-b form of the quadratic: t = (-b' -+ sqrt(b'^2 - a c)) / a
+            __m256 b = _mm256_fmadd_ps(ocZ, dirZ, _mm256_fmadd_ps(ocY, dirY, _mm256_mul_ps(ocX, dirX)));
+            __m256 c = _mm256_fmadd_ps(ocZ, ocZ, _mm256_fmadd_ps(ocY, ocY, _mm256_mul_ps(ocX, ocX)));
+            c = _mm256_fnmadd_ps(r, r, c);
+            __m256 discriminant = _mm256_fmsub_ps(b, b, _mm256_mul_ps(aV, c));
+            __m256 sqrtD = _mm256_sqrt_ps(_mm256_max_ps(discriminant, zero));
+            __m256 negB = _mm256_sub_ps(zero, b);
+            __m256 t1 = _mm256_div_ps(_mm256_sub_ps(negB, sqrtD), aV);
+            __m256 t2 = _mm256_div_ps(_mm256_add_ps(negB, sqrtD), aV);
+            __m256 t = _mm256_blendv_ps(t2, t1, _mm256_cmp_ps(t1, zero, _CMP_GE_OQ));
+
+            __m256 closer = _mm256_and_ps(_mm256_cmp_ps(discriminant, zero, _CMP_GE_OQ),
+                                          _mm256_and_ps(_mm256_cmp_ps(t, zero, _CMP_GE_OQ),
+                                                        _mm256_cmp_ps(t, bestT, _CMP_LT_OQ)));
+            bestT = _mm256_blendv_ps(bestT, t, closer);
+            bestIndex = _mm256_castps_si256(
+                _mm256_blendv_ps(_mm256_castsi256_ps(bestIndex), _mm256_castsi256_ps(index), closer));
+            index = _mm256_add_epi32(index, step);
+        }
+
+        alignas(32) float laneT[8];
+        alignas(32) std::int32_t laneIndex[8];
+        _mm256_store_ps(laneT, bestT);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(laneIndex), bestIndex);
+        constexpr int Lanes = 8;
+#elif defined(RAYTRACER_SIMD_SSE4)
+        const std::size_t padded = paddedCount;
+        const float a = ray.direction.Dot(ray.direction);
+        const __m128 originX = _mm_set1_ps(ray.origin.x);
+        const __m128 originY = _mm_set1_ps(ray.origin.y);
+        const __m128 originZ = _mm_set1_ps(ray.origin.z);
+        const __m128 dirX = _mm_set1_ps(ray.direction.x);
+        const __m128 dirY = _mm_set1_ps(ray.direction.y);
+        const __m128 dirZ = _mm_set1_ps(ray.direction.z);
+        const __m128 aV = _mm_set1_ps(a);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128i step = _mm_set1_epi32(4);
+
+        __m128 bestT = _mm_set1_ps(std::numeric_limits<float>::infinity());
+        __m128i bestIndex = _mm_set1_epi32(-1);
+        __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+
+        for (std::size_t i = 0; i < padded; i += 4)
+        {
+            __m128 ocX = _mm_sub_ps(originX, _mm_load_ps(centerX + i));
+            __m128 ocY = _mm_sub_ps(originY, _mm_load_ps(centerY + i));
+            __m128 ocZ = _mm_sub_ps(originZ, _mm_load_ps(centerZ + i));
+            __m128 r = _mm_load_ps(radius + i);
+
+            // Half-b form of the quadratic: t = (-b' -+ sqrt(b'^2 - a c)) / a
+            __m128 b = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ocX, dirX), _mm_mul_ps(ocY, dirY)), _mm_mul_ps(ocZ, dirZ));
+            __m128 c = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ocX, ocX), _mm_mul_ps(ocY, ocY)), _mm_mul_ps(ocZ, ocZ));
+            c = _mm_sub_ps(c, _mm_mul_ps(r, r));
+            __m128 discriminant = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(aV, c));
+            __m128 sqrtD = _mm_sqrt_ps(_mm_max_ps(discriminant, zero));
+            __m128 negB = _mm_sub_ps(zero, b);
+            __m128 t1 = _mm_div_ps(_mm_sub_ps(negB, sqrtD), aV);
+            __m128 t2 = _mm_div_ps(_mm_add_ps(negB, sqrtD), aV);
+            __m128 t = _mm_blendv_ps(t2, t1, _mm_cmpge_ps(t1, zero));
+
+            __m128 closer = _mm_and_ps(_mm_cmpge_ps(discriminant, zero),
+                                       _mm_and_ps(_mm_cmpge_ps(t, zero), _mm_cmplt_ps(t, bestT)));
+            bestT = _mm_blendv_ps(bestT, t, closer);
+            bestIndex = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(bestIndex), _mm_castsi128_ps(index), closer));
+            index = _mm_add_epi32(index, step);
+        }
+
+        alignas(16) float laneT[4];
+        alignas(16) std::int32_t laneIndex[4];
+        _mm_store_ps(laneT, bestT);
+        _mm_store_si128(reinterpret_cast<__m128i*>(laneIndex), bestIndex);
+        constexpr int Lanes = 4;
+#endif
+
+        Hit result;
+#if defined(RAYTRACER_SIMD_SSE4)
+        for (int lane = 0; lane < Lanes; ++lane)
+        {
+            if (laneIndex[lane] < 0)
+            {
+                continue;
+            }
+            std::uint32_t primitive = static_cast<std::uint32_t>(laneIndex[lane]);
+            if (!result.hit || laneT[lane] < result.t || (laneT[lane] == result.t && primitive < result.primitive))
+            {
+                result.hit = true;
+                result.t = laneT[lane];
+                result.primitive = primitive;
+            }
+        }
+#else
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float t;
+            if ((*this)[i].Intersect(ray, 0.0f, result.hit ? result.t : std::numeric_limits<float>::infinity(), t) &&
+                (!result.hit || t < result.t))
+            {
+                result.hit = true;
+                result.t = t;
+                result.primitive = static_cast<std::uint32_t>(i);
+            }
+        }
+#endif
+        if (result.hit)
+        {
+            (*this)[result.primitive].CompleteHit(ray, result);
+        }
+        return result;
+    }
+}
@@ -0,0 +1,313 @@
+#include "RayTracer/TextScene.hpp"
+#include "RayTracer/MappedFile.hpp"
+#include "RayTracer/Matrix.hpp"
+#include "RayTracer/ThreadPool.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <optional>
+
+namespace RayTracer
+{
+    namespace
+    {
+        // Small inputs are not worth splitting, and a few chunks per thread even out lines of different lengths.
+        constexpr std::size_t MinimumChunkSize = 256 * 1024;
+        constexpr unsigned ChunksPerThread = 4;
+
+        constexpr std::string_view SphereKeyword = "sphere";
+        constexpr std::string_view InstanceKeyword = "instance";
+        constexpr int InstanceValues = 12;
+
+        bool IsSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        /**
+         * Reads the whitespace separated tokens of a single line.
+         */
+        class LineReader
+        {
+          public:
+            explicit LineReader(std::string_view line)
+                : cursor{line.data()}
+                , end{line.data() + line.size()}
+            {
+            }
+
+            std::string_view Keyword()
+            {
+                SkipSpace();
+                const char* start = cursor;
+                while (cursor < end && !IsSpace(*cursor) && *cursor != '#')
+                {
+                    ++cursor;
+                }
+                return {start, static_cast<std::size_t>(cursor - start)};
+            }
+
+            template <typename T>
+            bool Number(T& value)
+            {
+                SkipSpace();
+                auto [next, error] = std::from_chars(cursor, end, value);
+                // A number must be followed by a separator, so "1.5.2" is an error rather than two numbers.
+                if (error != std::errc{} || (next < end && !IsSpace(*next) && *next != '#'))
+                {
+                    return false;
+                }
+                cursor = next;
+                return true;
+            }
+
+            bool AtEnd()
+            {
+                SkipSpace();
+                return cursor == end || *cursor == '#';
+            }
+
+          private:
+            void SkipSpace()
+            {
+                while (cursor < end && IsSpace(*cursor))
+                {
+                    ++cursor;
+                }
+            }
+
+            const char* cursor;
+            const char* end;
+        };
+
+        /**
+         * Calls function with every line of text, without the line break.
+         */
+        template <typename Function>
+        void ForEachLine(std::string_view text, const Function& function)
+        {
+            const char* cursor = text.data();
+            const char* end = text.data() + text.size();
+            while (cursor < end)
+            {
+                auto* newline =
+                    static_cast<const char*>(std::memchr(cursor, '\n', static_cast<std::size_t>(end - cursor)));
+                const char* lineEnd = newline != nullptr ? newline : end;
+                function(std::string_view{cursor, static_cast<std::size_t>(lineEnd - cursor)});
+                cursor = lineEnd + 1;
+            }
+        }
+
+        struct Chunk
+        {
+            std::string_view text;
+            std::size_t lines = 0;
+            std::size_t spheres = 0;
+            std::size_t instances = 0;
+            // Where the chunk starts in the whole file, known after the counting pass.
+            std::size_t firstLine = 0;
+            std::size_t firstSphere = 0;
+            std::size_t firstInstance = 0;
+            std::optional<TextSceneError> error;
+        };
+
+        std::vector<Chunk> SplitChunks(std::string_view text, unsigned threadCount)
+        {
+            std::size_t chunkCount = std::clamp<std::size_t>(text.size() / MinimumChunkSize, 1,
+                                                             std::max(threadCount, 1u) * ChunksPerThread);
+            std::vector<Chunk> chunks;
+            chunks.reserve(chunkCount);
+            std::size_t begin = 0;
+            for (std::size_t c = 1; c <= chunkCount && begin < text.size(); ++c)
+            {
+                std::size_t end = text.size();
+                if (c < chunkCount)
+                {
+                    // Move the split point forward to just past the next line break.
+                    std::size_t newline = text.find('\n', std::max(begin, text.size() * c / chunkCount));
+                    end = newline == std::string_view::npos ? text.size() : newline + 1;
+                }
+                chunks.emplace_back().text = text.substr(begin, end - begin);
+                begin = end;
+            }
+            return chunks;
+        }
+
+        void CountChunk(Chunk& chunk)
+        {
+            ForEachLine(chunk.text, [&](std::string_view line) {
+                ++chunk.lines;
+                std::string_view keyword = LineReader{line}.Keyword();
+                chunk.spheres += keyword == SphereKeyword ? 1 : 0;
+                chunk.instances += keyword == InstanceKeyword ? 1 : 0;
+            });
+        }
+
+        void ParseChunk(Chunk& chunk, SphereSoA& spheres, std::vector<Instance>& instances)
+        {
+            std::size_t line = chunk.firstLine;
+            std::size_t sphere = chunk.firstSphere;
+            std::size_t instance = chunk.firstInstance;
+            ForEachLine(chunk.text, [&](std::string_view text) {
+                ++line;
+                if (chunk.error)
+                {
+                    return;
+                }
+
+                LineReader reader{text};
+                std::string_view keyword = reader.Keyword();
+                if (keyword.empty())
+                {
+                    return;
+                }
+                if (keyword == SphereKeyword)
+                {
+                    float values[4];
+                    for (float& value : values)
+                    {
+                        if (!reader.Number(value))
+                        {
+                            chunk.error = TextSceneError{line, "expected sphere <x> <y> <z> <radius>"};
+                            return;
+                        }
+                    }
+                    spheres.Set(sphere++, {{values[0], values[1], values[2]}, values[3]});
+                }
+                else if (keyword == InstanceKeyword)
+                {
+                    std::uint32_t geometry;
+                    float values[InstanceValues];
+                    bool valid = reader.Number(geometry);
+                    for (int i = 0; valid && i < InstanceValues; ++i)
+                    {
+                        valid = reader.Number(values[i]);
+                    }
+                    if (!valid)
+                    {
+                        chunk.error = TextSceneError{line, "expected instance <geometry> and 12 matrix values"};
+                        return;
+                    }
+                    Matrix matrix = Matrix::Identity();
+                    for (int row = 0; row < 3; ++row)
+                    {
+                        for (int column = 0; column < 4; ++column)
+                        {
+                            matrix(row, column) = values[row * 4 + column];
+                        }
+                    }
+                    instances[instance++] = {geometry, Transform{matrix}};
+                }
+                else
+                {
+                    chunk.error = TextSceneError{line, "unknown keyword"};
+                    return;
+                }
+
+                if (!reader.AtEnd())
+                {
+                    chunk.error = TextSceneError{line, "unexpected values at the end of the line"};
+                }
+            });
+        }
+
+        template <typename Function>
+        void ForEachChunk(ThreadPool& pool, std::vector<Chunk>& chunks, const Function& function)
+        {
+            if (chunks.size() == 1)
+            {
+                function(chunks[0]);
+                return;
+            }
+            pool.ParallelFor(chunks.size(), [&](std::size_t i) { function(chunks[i]); });
+        }
+    }
+
+    std::expected<TextScene, TextSceneError> TextScene::Parse(std::string_view text, ThreadPool& pool)
+    {
+        std::vector<Chunk> chunks = SplitChunks(text, pool.ThreadCount());
+        ForEachChunk(pool, chunks, CountChunk);
+
+        std::size_t lines = 0;
+        std::size_t sphereCount = 0;
+        std::size_t instanceCount = 0;
+        for (Chunk& chunk : chunks)
+        {
+            chunk.firstLine = lines;
+            chunk.firstSphere = sphereCount;
+            chunk.firstInstance = instanceCount;
+            lines += chunk.lines;
+            sphereCount += chunk.spheres;
+            instanceCount += chunk.instances;
+        }
+
+        TextScene scene;
+        scene.spheres.Resize(sphereCount);
+        scene.instances.resize(instanceCount);
+        ForEachChunk(pool, chunks, [&](Chunk& chunk) { ParseChunk(chunk, scene.spheres, scene.instances); });
+
+        // Chunks are in file order, so the first error found is also the first in the file.
+        for (const Chunk& chunk : chunks)
+        {
+            if (chunk.error)
+            {
+                return std::unexpected{*chunk.error};
+            }
+        }
+        return scene;
+    }
+
+    std::expected<TextScene, TextSceneError> TextScene::Load(const std::filesystem::path& path, ThreadPool& pool)
+    {
+        // Parsed in place from the mapping, so pages are read in parallel as the chunks reach them and the text is
+        // never copied.
+        auto file = MappedFile::Open(path);
+        if (!file)
+        {
+            return std::unexpected{TextSceneError{
+                0, file.error() == MappedFile::Error::CannotOpen ? "cannot open file" : "cannot map file"}};
+        }
+        return Parse({reinterpret_cast<const char*>(file->Data()), file->Size()}, pool);
+    }
+
+    void TextScene::Write(std::ostream& stream, const SphereSoAView& spheres, std::span<const Instance> instances)
+    {
+        // Shortest round trip floats, formatted into one buffer per line.
+        char buffer[512];
+        auto append = [&](char* cursor, auto value) {
+            *cursor++ = ' ';
+            return std::to_chars(cursor, buffer + sizeof(buffer), value).ptr;
+        };
+        auto writeLine = [&](std::string_view keyword, char* end) {
+            *end++ = '\n';
+            stream.write(keyword.data(), static_cast<std::streamsize>(keyword.size()));
+            stream.write(buffer, end - buffer);
+        };
+
+        for (std::size_t i = 0; i < spheres.Size(); ++i)
+        {
+            Sphere sphere = spheres[i];
+            char* cursor = buffer;
+            for (float value : {sphere.center.x, sphere.center.y, sphere.center.z, sphere.radius})
+            {
+                cursor = append(cursor, value);
+            }
+            writeLine(SphereKeyword, cursor);
+        }
+
+        for (const Instance& instance : instances)
+        {
+            Matrix matrix = instance.transform.ToMatrix();
+            char* cursor = append(buffer, instance.geometry);
+            for (int row = 0; row < 3; ++row)
+            {
+                for (int column = 0; column < 4; ++column)
+                {
+                    cursor = append(cursor, matrix(row, column));
+                }
+            }
+            writeLine(InstanceKeyword, cursor);
+        }
+    }
+}
@@ -0,0 +1,165 @@
+#include "RayTracer/ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace RayTracer
+{
+    namespace
+    {
+        // The pool and index of the worker running on this thread, if any.
+        thread_local const ThreadPool* currentPool = nullptr;
+        thread_local unsigned currentWorker = 0;
+    }
+
+    ThreadPool::ThreadPool(unsigned threadCount)
+    {
+        if (threadCount == 0)
+        {
+            threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+
+        workers.reserve(threadCount);
+        for (unsigned i = 0; i < threadCount; ++i)
+        {
+            workers.push_back(std::make_unique<Worker>());
+        }
+        threads.reserve(threadCount);
+        for (unsigned i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([this, i] { Run(i); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stopping = true;
+        }
+        workAvailable.notify_all();
+        threads.clear();
+    }
+
+    void ThreadPool::Submit(Task task)
+    {
+        {
+            // Counted before the task becomes visible so a worker can never take it while queued is still zero.
+            std::lock_guard lock{mutex};
+            ++pending;
+            queued.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Worker& worker = *workers[nextQueue.fetch_add(1, std::memory_order_relaxed) % workers.size()];
+        {
+            std::lock_guard lock{worker.mutex};
+            worker.tasks.push_back(std::move(task));
+        }
+        workAvailable.notify_one();
+    }
+
+    void ThreadPool::Wait()
+    {
+        std::unique_lock lock{mutex};
+        allDone.wait(lock, [this] { return pending == 0; });
+    }
+
+    unsigned ThreadPool::CurrentWorker() const
+    {
+        return currentPool == this ? currentWorker : ThreadCount();
+    }
+
+    std::vector<ThreadPool::WorkerStats> ThreadPool::Stats() const
+    {
+        std::vector<WorkerStats> stats;
+        stats.reserve(workers.size());
+        for (const auto& worker : workers)
+        {
+            std::lock_guard lock{worker->mutex};
+            stats.push_back(worker->stats);
+        }
+        return stats;
+    }
+
+    void ThreadPool::ResetStats()
+    {
+        for (auto& worker : workers)
+        {
+            std::lock_guard lock{worker->mutex};
+            worker->stats = {};
+        }
+    }
+
+    bool ThreadPool::TryPop(unsigned index, Task& task)
+    {
+        Worker& worker = *workers[index];
+        std::lock_guard lock{worker.mutex};
+        if (worker.tasks.empty())
+        {
+            return false;
+        }
+        task = std::move(worker.tasks.back());
+        worker.tasks.pop_back();
+        return true;
+    }
+
+    bool ThreadPool::TrySteal(unsigned index, Task& task)
+    {
+        for (std::size_t offset = 1; offset < workers.size(); ++offset)
+        {
+            Worker& victim = *workers[(index + offset) % workers.size()];
+            std::lock_guard lock{victim.mutex};
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ThreadPool::Run(unsigned index)
+    {
+        Worker& worker = *workers[index];
+        currentPool = this;
+        currentWorker = index;
+        while (true)
+        {
+            Task task;
+            bool stolen = false;
+            if (!TryPop(index, task))
+            {
+                stolen = TrySteal(index, task);
+            }
+
+            if (task)
+            {
+                queued.fetch_sub(1, std::memory_order_relaxed);
+                auto start = std::chrono::steady_clock::now();
+                task(index);
+                auto busy = std::chrono::steady_clock::now() - start;
+                {
+                    // The queue lock also guards the statistics, which Stats may read while tasks run.
+                    std::lock_guard lock{worker.mutex};
+                    worker.stats.busy += busy;
+                    ++worker.stats.tasks;
+                    worker.stats.steals += stolen ? 1 : 0;
+                }
+
+                std::lock_guard lock{mutex};
+                if (--pending == 0)
+                {
+                    allDone.notify_all();
+                }
+                continue;
+            }
+
+            std::unique_lock lock{mutex};
+            workAvailable.wait(lock, [this] { return stopping || queued.load(std::memory_order_relaxed) > 0; });
+            if (stopping && queued.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+        }
+    }
+}
@@ -0,0 +1,164 @@
+#include "RayTracer/ToneMap.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace RayTracer
+{
+    namespace
+    {
+        // Larger inputs are clamped before tone mapping, so infinities map to white instead of NaN.
+        constexpr float MaxInput = 1.0e4f;
+
+        float Aces(float x)
+        {
+            return x * (2.51f * x + 0.03f) / (x * (2.43f * x + 0.59f) + 0.14f);
+        }
+
+#if defined(RAYTRACER_SIMD_AVX2)
+        /**
+         * Converts pixels in groups of eight and returns how many were converted. Each 256-bit register holds two
+         * padded colors, whose lanes go through the same steps as ToneMapper::ToneMap, so the padding lane produces
+         * a byte that is overwritten by the alpha.
+         */
+        std::size_t ConvertRow8(const ToneMapper::Settings& settings, const std::uint8_t* lut, const Color* in,
+                                std::uint32_t* out, std::size_t count)
+        {
+            static_assert(sizeof(Color) == 4 * sizeof(float));
+
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 one = _mm256_set1_ps(1.0f);
+            const __m256 exposure = _mm256_set1_ps(settings.exposure);
+            const __m256 maxInput = _mm256_set1_ps(MaxInput);
+            const __m256 lutScale = _mm256_set1_ps(static_cast<float>(ToneMapper::LutSize - 1));
+            const __m256 half = _mm256_set1_ps(0.5f);
+            const __m256i byteMask = _mm256_set1_epi32(0xFF);
+            const __m256i alpha = _mm256_set1_epi32(static_cast<int>(PackRgba8(0, 0, 0, 255)));
+            // packus interleaves the 128-bit halves, this restores the pixel order.
+            const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+            const float* channels = &in[0].r;
+            const int* table = reinterpret_cast<const int*>(lut);
+
+            auto encode = [&](const float* pair) {
+                // max_ps returns its second operand for NaN, which clears NaN channels to zero.
+                __m256 x = _mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(pair), exposure), zero);
+                x = _mm256_min_ps(x, maxInput);
+                if (settings.toneMap == ToneMapOperator::Reinhard)
+                {
+                    x = _mm256_div_ps(x, _mm256_add_ps(x, one));
+                }
+                else if (settings.toneMap == ToneMapOperator::Aces)
+                {
+                    __m256 numerator =
+                        _mm256_mul_ps(x, _mm256_fmadd_ps(x, _mm256_set1_ps(2.51f), _mm256_set1_ps(0.03f)));
+                    __m256 denominator = _mm256_fmadd_ps(
+                        x, _mm256_fmadd_ps(x, _mm256_set1_ps(2.43f), _mm256_set1_ps(0.59f)), _mm256_set1_ps(0.14f));
+                    x = _mm256_div_ps(numerator, denominator);
+                }
+                x = _mm256_min_ps(x, one);
+                __m256i index = _mm256_cvttps_epi32(_mm256_fmadd_ps(x, lutScale, half));
+                // Byte sized gather: read 32 bits at each entry and keep the low byte.
+                return _mm256_and_si256(_mm256_i32gather_epi32(table, index, 1), byteMask);
+            };
+
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                const float* block = channels + 4 * i;
+                __m256i p01 = encode(block);
+                __m256i p23 = encode(block + 8);
+                __m256i p45 = encode(block + 16);
+                __m256i p67 = encode(block + 24);
+                __m256i words0 = _mm256_packus_epi32(p01, p23);
+                __m256i words1 = _mm256_packus_epi32(p45, p67);
+                __m256i bytes = _mm256_packus_epi16(words0, words1);
+                bytes = _mm256_or_si256(_mm256_permutevar8x32_epi32(bytes, order), alpha);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), bytes);
+            }
+            return i;
+        }
+#endif
+    }
+
+    Rgba8Image::Rgba8Image(int width, int height)
+        : width{width}
+        , height{height}
+    {
+        std::size_t pixelsPerLine = CacheLineSize / std::gcd(CacheLineSize, sizeof(std::uint32_t));
+        stride = (static_cast<std::size_t>(width) + pixelsPerLine - 1) / pixelsPerLine * pixelsPerLine;
+        pixels.resize(stride * static_cast<std::size_t>(height));
+    }
+
+    ToneMapper::ToneMapper()
+        : ToneMapper{Settings{}}
+    {
+    }
+
+    ToneMapper::ToneMapper(const Settings& settings)
+        : settings{settings}
+        , lut(LutSize + sizeof(std::uint32_t) - 1, 0)
+    {
+        for (int i = 0; i < LutSize; ++i)
+        {
+            float value = LinearToSrgb(static_cast<float>(i) / static_cast<float>(LutSize - 1));
+            lut[i] = static_cast<std::uint8_t>(value * 255.0f + 0.5f);
+        }
+    }
+
+    void ToneMapper::ConvertRow(std::span<const Color> in, std::span<std::uint32_t> out) const
+    {
+        const std::size_t count = std::min(in.size(), out.size());
+        std::size_t i = 0;
+#if defined(RAYTRACER_SIMD_AVX2)
+        i = ConvertRow8(settings, lut.data(), in.data(), out.data(), count);
+#endif
+        constexpr float Scale = static_cast<float>(LutSize - 1);
+        for (; i < count; ++i)
+        {
+            auto encode = [&](float value) {
+                return lut[static_cast<int>(ToneMap(value) * Scale + 0.5f)];
+            };
+            out[i] = PackRgba8(encode(in[i].r), encode(in[i].g), encode(in[i].b));
+        }
+    }
+
+    void ToneMapper::ConvertTile(const Framebuffer& framebuffer, const Tile& tile, Rgba8Image& image) const
+    {
+        for (int y = tile.y; y < tile.y + tile.height; ++y)
+        {
+            ConvertRow(framebuffer.Row(y).subspan(tile.x, tile.width), image.Row(y).subspan(tile.x, tile.width));
+        }
+    }
+
+    void ToneMapper::Convert(ThreadPool& pool, const Framebuffer& framebuffer, Rgba8Image& image, int tileSize) const
+    {
+        const std::vector<Tile> tiles = Renderer::SplitTiles(framebuffer.Width(), framebuffer.Height(), tileSize);
+        pool.ParallelFor(tiles.size(), [&](std::size_t i) { ConvertTile(framebuffer, tiles[i], image); });
+    }
+
+    float ToneMapper::ToneMap(float value) const
+    {
+        float x = value * settings.exposure;
+        // The comparison is false for NaN, which becomes zero.
+        x = x > 0.0f ? std::min(x, MaxInput) : 0.0f;
+        if (settings.toneMap == ToneMapOperator::Reinhard)
+        {
+            x = x / (x + 1.0f);
+        }
+        else if (settings.toneMap == ToneMapOperator::Aces)
+        {
+            x = Aces(x);
+        }
+        return std::min(x, 1.0f);
+    }
+
+    float ToneMapper::LinearToSrgb(float value)
+    {
+        if (value <= 0.0031308f)
+        {
+            return 12.92f * value;
+        }
+        return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    }
+}
@@ -0,0 +1,115 @@
+#include "RayTracer/Transform.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace RayTracer
+{
+    namespace
+    {
+        Vector3 Apply(const Vector3 (&columns)[3], const Vector3& vector)
+        {
+            return columns[0] * vector.x + columns[1] * vector.y + columns[2] * vector.z;
+        }
+
+        void Transpose(const Vector3 (&columns)[3], Vector3 (&transposed)[3])
+        {
+#if defined(RAYTRACER_SIMD_SSE4)
+            __m128 column0 = columns[0].Load();
+            __m128 column1 = columns[1].Load();
+            __m128 column2 = columns[2].Load();
+            __m128 column3 = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+            transposed[0] = Vector3{column0};
+            transposed[1] = Vector3{column1};
+            transposed[2] = Vector3{column2};
+#else
+            for (int c = 0; c < 3; ++c)
+            {
+                transposed[c] = {columns[0][c], columns[1][c], columns[2][c]};
+            }
+#endif
+        }
+    }
+
+    Transform::Transform()
+        : linear{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}
+        , translation{0.0f, 0.0f, 0.0f}
+        , inverseLinear{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}
+        , inverseTranslation{0.0f, 0.0f, 0.0f}
+        , normalLinear{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}
+    {
+    }
+
+    Transform::Transform(const Matrix& matrix)
+        : Transform()
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            linear[c] = {matrix(0, c), matrix(1, c), matrix(2, c)};
+        }
+        translation = {matrix(0, 3), matrix(1, 3), matrix(2, 3)};
+
+        // The rows of the inverse of a 3x3 matrix are the cross products of pairs of its columns over the
+        // determinant, and those rows are exactly the columns of the inverse-transpose.
+        Vector3 rows[3] = {linear[1].Cross(linear[2]), linear[2].Cross(linear[0]), linear[0].Cross(linear[1])};
+        float det = linear[0].Dot(rows[0]);
+        if (std::fabsf(det) < std::numeric_limits<float>::epsilon())
+        {
+            // Singular transform, keep the identity inverse like Matrix::Inverse
+            return;
+        }
+
+        float inverseDet = 1.0f / det;
+        for (int i = 0; i < 3; ++i)
+        {
+            normalLinear[i] = rows[i] * inverseDet;
+        }
+        Transpose(normalLinear, inverseLinear);
+        inverseTranslation = -Apply(inverseLinear, translation);
+    }
+
+    Transform::Transform(const Vector3 (&linear)[3], const Vector3& translation, const Vector3 (&inverseLinear)[3],
+                         const Vector3& inverseTranslation)
+        : linear{linear[0], linear[1], linear[2]}
+        , translation{translation}
+        , inverseLinear{inverseLinear[0], inverseLinear[1], inverseLinear[2]}
+        , inverseTranslation{inverseTranslation}
+    {
+        Transpose(inverseLinear, normalLinear);
+    }
+
+    Transform Transform::operator*(const Transform& other) const
+    {
+        // Forward: other after this. Inverse: the inverse of this after the inverse of other.
+        Vector3 composedLinear[3];
+        Vector3 composedInverseLinear[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            composedLinear[c] = Apply(other.linear, linear[c]);
+            composedInverseLinear[c] = Apply(inverseLinear, other.inverseLinear[c]);
+        }
+        return Transform{composedLinear, other.TransformPoint(translation), composedInverseLinear,
+                         Apply(inverseLinear, other.inverseTranslation) + inverseTranslation};
+    }
+
+    Transform Transform::Inverse() const
+    {
+        return Transform{inverseLinear, inverseTranslation, linear, translation};
+    }
+
+    Matrix Transform::ToMatrix() const
+    {
+        Matrix result = Matrix::Identity();
+        for (int c = 0; c < 3; ++c)
+        {
+            result(0, c) = linear[c].x;
+            result(1, c) = linear[c].y;
+            result(2, c) = linear[c].z;
+        }
+        result(0, 3) = translation.x;
+        result(1, 3) = translation.y;
+        result(2, 3) = translation.z;
+        return result;
+    }
+}
@@ -0,0 +1,349 @@
+#include "RayTracer/Wavefront.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace RayTracer
+{
+    namespace
+    {
+        /**
+         * One step of a PCG generator with an RXS-M-XS output permutation, which is small enough to keep one state
+         * per path.
+         */
+        std::uint32_t NextRandom(std::uint32_t& state)
+        {
+            state = state * 747796405u + 2891336453u;
+            std::uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+            return (word >> 22u) ^ word;
+        }
+
+        float RandomFloat(std::uint32_t& state)
+        {
+            // The top 24 bits give every float in [0, 1) with a spacing of 2^-24.
+            return static_cast<float>(NextRandom(state) >> 8) * 0x1p-24f;
+        }
+
+        std::uint32_t Seed(std::uint32_t pixel, int sample)
+        {
+            std::uint32_t state = static_cast<std::uint32_t>(sample);
+            state = NextRandom(state) ^ pixel;
+            NextRandom(state);
+            return state;
+        }
+
+        /**
+         * Cosine weighted direction around normal, using the branchless orthonormal basis of Duff et al.
+         */
+        Vector3 SampleCosine(const Vector3& normal, float u1, float u2)
+        {
+            float sign = std::copysign(1.0f, normal.z);
+            float a = -1.0f / (sign + normal.z);
+            float b = normal.x * normal.y * a;
+            Vector3 tangent{1.0f + sign * normal.x * normal.x * a, sign * b, -sign * normal.x};
+            Vector3 bitangent{b, sign + normal.y * normal.y * a, -normal.y};
+
+            float radius = std::sqrt(u1);
+            float phi = 2.0f * std::numbers::pi_v<float> * u2;
+            float z = std::sqrt(std::max(0.0f, 1.0f - u1));
+            return (tangent * (radius * std::cos(phi)) + bitangent * (radius * std::sin(phi)) + normal * z)
+                .Normalized();
+        }
+    }
+
+    PathQueue::PathQueue(std::size_t capacity, std::pmr::memory_resource* memory)
+        : originX(capacity, memory)
+        , originY(capacity, memory)
+        , originZ(capacity, memory)
+        , directionX(capacity, memory)
+        , directionY(capacity, memory)
+        , directionZ(capacity, memory)
+        , throughputR(capacity, memory)
+        , throughputG(capacity, memory)
+        , throughputB(capacity, memory)
+        , pixel(capacity, memory)
+        , random(capacity, memory)
+    {
+    }
+
+    HitQueue::HitQueue(std::size_t capacity, std::pmr::memory_resource* memory)
+        : t(capacity, memory)
+        , normalX(capacity, memory)
+        , normalY(capacity, memory)
+        , normalZ(capacity, memory)
+        , material(capacity, memory)
+    {
+    }
+
+    SurfaceQueue::SurfaceQueue(std::size_t capacity, std::pmr::memory_resource* memory)
+        : positionX(capacity, memory)
+        , positionY(capacity, memory)
+        , positionZ(capacity, memory)
+        , normalX(capacity, memory)
+        , normalY(capacity, memory)
+        , normalZ(capacity, memory)
+        , viewX(capacity, memory)
+        , viewY(capacity, memory)
+        , viewZ(capacity, memory)
+        , material(capacity, memory)
+        , path(capacity, memory)
+        , toLightX(capacity, memory)
+        , toLightY(capacity, memory)
+        , toLightZ(capacity, memory)
+        , lightDistance(capacity, memory)
+        , radianceR(capacity, memory)
+        , radianceG(capacity, memory)
+        , radianceB(capacity, memory)
+    {
+    }
+
+    ShadowQueue::ShadowQueue(std::size_t capacity, std::pmr::memory_resource* memory)
+        : originX(capacity, memory)
+        , originY(capacity, memory)
+        , originZ(capacity, memory)
+        , directionX(capacity, memory)
+        , directionY(capacity, memory)
+        , directionZ(capacity, memory)
+        , tMax(capacity, memory)
+        , contributionR(capacity, memory)
+        , contributionG(capacity, memory)
+        , contributionB(capacity, memory)
+        , pixel(capacity, memory)
+    {
+    }
+
+    SortQueue::SortQueue(std::size_t capacity, std::pmr::memory_resource* memory)
+        : keys(capacity, memory)
+        , order(capacity, memory)
+        , keyScratch(capacity, memory)
+        , orderScratch(capacity, memory)
+    {
+    }
+
+    Accumulator::Accumulator(std::size_t capacity, std::pmr::memory_resource* memory)
+        : r(capacity, 0.0f, memory)
+        , g(capacity, 0.0f, memory)
+        , b(capacity, 0.0f, memory)
+    {
+    }
+
+    WavefrontIntegrator::WavefrontIntegrator(const Camera& camera, const Settings& settings)
+        : camera{camera}
+        , settings{settings}
+    {
+        // Validated once here, so that the shading kernels can index and gather materials without bounds checks.
+        if (this->settings.materials.empty())
+        {
+            this->settings.materials = Settings{}.materials;
+        }
+        for (std::uint32_t& id : this->settings.materialIds)
+        {
+            if (id >= this->settings.materials.size())
+            {
+                id = 0;
+            }
+        }
+    }
+
+    void WavefrontIntegrator::Generate(const Tile& tile, int sample, PathQueue& paths) const
+    {
+        const std::size_t count = static_cast<std::size_t>(tile.width) * static_cast<std::size_t>(tile.height);
+        std::size_t i = 0;
+        ForEachPixel(tile, settings.pixelOrder, [&](int x, int y) {
+            paths.pixel[i] = static_cast<std::uint32_t>((y - tile.y) * tile.width + (x - tile.x));
+            // Seeded by the image pixel, so a pixel gets the same samples whatever tile size it is rendered with.
+            paths.random[i] = Seed(static_cast<std::uint32_t>(y * camera.Width() + x), sample);
+            ++i;
+        });
+
+        if (settings.pixelOrder == PixelOrder::Scanline)
+        {
+            camera.GenerateRays(tile, {paths.directionX, paths.directionY, paths.directionZ});
+        }
+        else
+        {
+            // The rays are generated row by row into the origin arrays, which are free until the end of this
+            // function, and gathered into path order from there.
+            camera.GenerateRays(tile, {paths.originX, paths.originY, paths.originZ});
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                paths.directionX[j] = paths.originX[paths.pixel[j]];
+                paths.directionY[j] = paths.originY[paths.pixel[j]];
+                paths.directionZ[j] = paths.originZ[paths.pixel[j]];
+            }
+        }
+
+        const Vector3& origin = camera.Position();
+        std::fill_n(paths.originX.begin(), count, origin.x);
+        std::fill_n(paths.originY.begin(), count, origin.y);
+        std::fill_n(paths.originZ.begin(), count, origin.z);
+        std::fill_n(paths.throughputR.begin(), count, 1.0f);
+        std::fill_n(paths.throughputG.begin(), count, 1.0f);
+        std::fill_n(paths.throughputB.begin(), count, 1.0f);
+        paths.size = count;
+    }
+
+    void WavefrontIntegrator::Sort(const PathQueue& paths, SortQueue& sortQueue, PathQueue& sorted)
+    {
+        const std::size_t count = paths.size;
+        Aabb bounds;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            bounds.Expand(Vector3{paths.originX[i], paths.originY[i], paths.originZ[i]});
+        }
+
+        const RaySortKey key{bounds};
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            sortQueue.keys[i] = key({paths.originX[i], paths.originY[i], paths.originZ[i]},
+                                    {paths.directionX[i], paths.directionY[i], paths.directionZ[i]});
+            sortQueue.order[i] = static_cast<std::uint32_t>(i);
+        }
+        RadixSort(std::span{sortQueue.keys}.first(count), std::span{sortQueue.order}.first(count),
+                  sortQueue.keyScratch, sortQueue.orderScratch, RaySortKey::Bits);
+
+        // One gather per array, so each pass streams through a single destination.
+        auto gather = [&](const auto& source, auto& target) {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                target[i] = source[sortQueue.order[i]];
+            }
+        };
+        gather(paths.originX, sorted.originX);
+        gather(paths.originY, sorted.originY);
+        gather(paths.originZ, sorted.originZ);
+        gather(paths.directionX, sorted.directionX);
+        gather(paths.directionY, sorted.directionY);
+        gather(paths.directionZ, sorted.directionZ);
+        gather(paths.throughputR, sorted.throughputR);
+        gather(paths.throughputG, sorted.throughputG);
+        gather(paths.throughputB, sorted.throughputB);
+        gather(paths.pixel, sorted.pixel);
+        gather(paths.random, sorted.random);
+        sorted.size = count;
+    }
+
+    void WavefrontIntegrator::Shade(const PathQueue& paths, const HitQueue& hits, int depth, SurfaceQueue& surfaces,
+                                    PathQueue& next, ShadowQueue& shadows, Accumulator& accumulator) const
+    {
+        surfaces.size = 0;
+        next.size = 0;
+        shadows.size = 0;
+
+        for (std::size_t i = 0; i < paths.size; ++i)
+        {
+            const float directionX = paths.directionX[i];
+            const float directionY = paths.directionY[i];
+            const float directionZ = paths.directionZ[i];
+
+            if (std::isinf(hits.t[i]))
+            {
+                float blend = 0.5f * (directionY + 1.0f);
+                Color sky = (1.0f - blend) * settings.skyHorizon + blend * settings.skyZenith;
+                const std::uint32_t pixel = paths.pixel[i];
+                accumulator.r[pixel] += paths.throughputR[i] * sky.r;
+                accumulator.g[pixel] += paths.throughputG[i] * sky.g;
+                accumulator.b[pixel] += paths.throughputB[i] * sky.b;
+                continue;
+            }
+
+            const float t = hits.t[i];
+            std::size_t s = surfaces.size++;
+            surfaces.positionX[s] = paths.originX[i] + directionX * t;
+            surfaces.positionY[s] = paths.originY[i] + directionY * t;
+            surfaces.positionZ[s] = paths.originZ[i] + directionZ * t;
+            surfaces.normalX[s] = hits.normalX[i];
+            surfaces.normalY[s] = hits.normalY[i];
+            surfaces.normalZ[s] = hits.normalZ[i];
+            surfaces.viewX[s] = -directionX;
+            surfaces.viewY[s] = -directionY;
+            surfaces.viewZ[s] = -directionZ;
+            surfaces.material[s] = hits.material[i];
+            surfaces.path[s] = static_cast<std::uint32_t>(i);
+        }
+
+        const SurfaceBatch batch = surfaces.Batch();
+        for (const Light& light : settings.lights)
+        {
+            SampleLight(batch, settings.materials, light, surfaces.Samples());
+            for (std::size_t s = 0; s < surfaces.size; ++s)
+            {
+                const std::uint32_t i = surfaces.path[s];
+                Color contribution = Color{paths.throughputR[i], paths.throughputG[i], paths.throughputB[i]} *
+                                     Color{surfaces.radianceR[s], surfaces.radianceG[s], surfaces.radianceB[s]};
+                if (contribution.r <= 0.0f && contribution.g <= 0.0f && contribution.b <= 0.0f)
+                {
+                    continue;
+                }
+
+                std::size_t shadow = shadows.size++;
+                shadows.originX[shadow] = surfaces.positionX[s];
+                shadows.originY[shadow] = surfaces.positionY[s];
+                shadows.originZ[shadow] = surfaces.positionZ[s];
+                shadows.directionX[shadow] = surfaces.toLightX[s];
+                shadows.directionY[shadow] = surfaces.toLightY[s];
+                shadows.directionZ[shadow] = surfaces.toLightZ[s];
+                shadows.tMax[shadow] = surfaces.lightDistance[s];
+                shadows.contributionR[shadow] = contribution.r;
+                shadows.contributionG[shadow] = contribution.g;
+                shadows.contributionB[shadow] = contribution.b;
+                shadows.pixel[shadow] = paths.pixel[i];
+            }
+        }
+
+        if (depth + 1 >= settings.maxDepth)
+        {
+            return;
+        }
+
+        for (std::size_t s = 0; s < surfaces.size; ++s)
+        {
+            const std::uint32_t i = surfaces.path[s];
+
+            // Cosine sampling cancels the cosine and 1/pi of the diffuse BRDF, leaving just the albedo.
+            std::uint32_t random = paths.random[i];
+            Color throughput = Color{paths.throughputR[i], paths.throughputG[i], paths.throughputB[i]} *
+                               settings.materials[surfaces.material[s]].diffuse;
+            if (depth >= settings.rouletteDepth)
+            {
+                float survival = std::min(std::max({throughput.r, throughput.g, throughput.b}), 0.95f);
+                if (RandomFloat(random) >= survival)
+                {
+                    continue;
+                }
+                throughput = throughput / survival;
+            }
+            float u1 = RandomFloat(random);
+            float u2 = RandomFloat(random);
+            Vector3 bounce = SampleCosine({surfaces.normalX[s], surfaces.normalY[s], surfaces.normalZ[s]}, u1, u2);
+
+            // Compaction: surviving paths are packed to the front of next in their original order.
+            std::size_t n = next.size++;
+            next.originX[n] = surfaces.positionX[s];
+            next.originY[n] = surfaces.positionY[s];
+            next.originZ[n] = surfaces.positionZ[s];
+            next.directionX[n] = bounce.x;
+            next.directionY[n] = bounce.y;
+            next.directionZ[n] = bounce.z;
+            next.throughputR[n] = throughput.r;
+            next.throughputG[n] = throughput.g;
+            next.throughputB[n] = throughput.b;
+            next.pixel[n] = paths.pixel[i];
+            next.random[n] = random;
+        }
+    }
+
+    void WavefrontIntegrator::Resolve(const Tile& tile, const Accumulator& accumulator, Framebuffer& framebuffer) const
+    {
+        const float scale = 1.0f / static_cast<float>(settings.samplesPerPixel);
+        std::size_t i = 0;
+        for (int y = tile.y; y < tile.y + tile.height; ++y)
+        {
+            for (int x = tile.x; x < tile.x + tile.width; ++x, ++i)
+            {
+                framebuffer.At(x, y) = Color{accumulator.r[i], accumulator.g[i], accumulator.b[i]} * scale;
+            }
+        }
+    }
+}
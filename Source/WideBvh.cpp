@@ -0,0 +1,325 @@
+#include "RayTracer/WideBvh.hpp"
+#include "RayTracer/Simd.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace RayTracer
+{
+    namespace
+    {
+        /**
+         * The child bounds planes a ray enters and leaves through, selected once per node from the direction signs so
+         * that the slab test needs no min/max per axis.
+         */
+        struct SlabPlanes
+        {
+            const float* entry[3];
+            const float* exit[3];
+        };
+
+        template <int Width>
+        SlabPlanes SelectPlanes(const typename WideBvh<Width>::Node& node, const TraversalRay& ray)
+        {
+            const float* mins[3] = {node.minX, node.minY, node.minZ};
+            const float* maxs[3] = {node.maxX, node.maxY, node.maxZ};
+            SlabPlanes planes;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                planes.entry[axis] = ray.sign[axis] ? maxs[axis] : mins[axis];
+                planes.exit[axis] = ray.sign[axis] ? mins[axis] : maxs[axis];
+            }
+            return planes;
+        }
+
+        template <int Width>
+        int IntersectChildrenScalar(const typename WideBvh<Width>::Node& node, const TraversalRay& ray, float tMax,
+                                    float* tEntry)
+        {
+            SlabPlanes planes = SelectPlanes<Width>(node, ray);
+            int mask = 0;
+            for (int i = 0; i < node.childCount; ++i)
+            {
+                float tNear = ray.tMin;
+                float tFar = tMax;
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    float t0 = (planes.entry[axis][i] - ray.ray.origin[axis]) * ray.inverseDirection[axis];
+                    float t1 = (planes.exit[axis][i] - ray.ray.origin[axis]) * ray.inverseDirection[axis];
+                    tNear = std::max(tNear, t0);
+                    tFar = std::min(tFar, t1);
+                }
+                tEntry[i] = tNear;
+                if (tNear <= tFar)
+                {
+                    mask |= 1 << i;
+                }
+            }
+            return mask;
+        }
+
+        /**
+         * Slab test of the ray against all children of a node. Returns a bit mask of the children that were hit and
+         * writes their entry distances to tEntry.
+         */
+        template <int Width>
+        int IntersectChildren(const typename WideBvh<Width>::Node& node, const TraversalRay& ray, float tMax,
+                              float* tEntry)
+        {
+            const int validMask = (1 << node.childCount) - 1;
+#if defined(RAYTRACER_SIMD_AVX2)
+            if constexpr (Width == 8)
+            {
+                SlabPlanes planes = SelectPlanes<Width>(node, ray);
+                __m256 tNear = _mm256_set1_ps(ray.tMin);
+                __m256 tFar = _mm256_set1_ps(tMax);
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    __m256 origin = _mm256_set1_ps(ray.ray.origin[axis]);
+                    __m256 inverse = _mm256_set1_ps(ray.inverseDirection[axis]);
+                    __m256 t0 = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(planes.entry[axis]), origin), inverse);
+                    __m256 t1 = _mm256_mul_ps(_mm256_sub_ps(_mm256_load_ps(planes.exit[axis]), origin), inverse);
+                    tNear = _mm256_max_ps(tNear, t0);
+                    tFar = _mm256_min_ps(tFar, t1);
+                }
+                _mm256_storeu_ps(tEntry, tNear);
+                return _mm256_movemask_ps(_mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ)) & validMask;
+            }
+#endif
+#if defined(RAYTRACER_SIMD_SSE4)
+            if constexpr (Width == 4)
+            {
+                SlabPlanes planes = SelectPlanes<Width>(node, ray);
+                __m128 tNear = _mm_set1_ps(ray.tMin);
+                __m128 tFar = _mm_set1_ps(tMax);
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    __m128 origin = _mm_set1_ps(ray.ray.origin[axis]);
+                    __m128 inverse = _mm_set1_ps(ray.inverseDirection[axis]);
+                    __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(planes.entry[axis]), origin), inverse);
+                    __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(planes.exit[axis]), origin), inverse);
+                    tNear = _mm_max_ps(tNear, t0);
+                    tFar = _mm_min_ps(tFar, t1);
+                }
+                _mm_storeu_ps(tEntry, tNear);
+                return _mm_movemask_ps(_mm_cmple_ps(tNear, tFar)) & validMask;
+            }
+#endif
+            return IntersectChildrenScalar<Width>(node, ray, tMax, tEntry) & validMask;
+        }
+    }
+
+    template <int Width>
+    WideBvh<Width>::WideBvh(const Bvh& bvh)
+        : primitiveIndices{bvh.PrimitiveIndices().begin(), bvh.PrimitiveIndices().end()}
+        , spheres{bvh.Spheres().begin(), bvh.Spheres().end()}
+    {
+        std::span<const BvhNode> binary = bvh.Nodes();
+        if (!binary.empty())
+        {
+            nodes.reserve(binary.size() / (Width - 1) + 1);
+            Collapse(binary, 0);
+        }
+    }
+
+    template <int Width>
+    std::uint32_t WideBvh<Width>::Collapse(std::span<const BvhNode> binary, std::uint32_t binaryIndex)
+    {
+        std::uint32_t nodeIndex = static_cast<std::uint32_t>(nodes.size());
+        nodes.emplace_back();
+
+        // Gather up to Width binary nodes below this one, repeatedly opening the interior node with the largest
+        // surface area since it is the most likely to be traversed.
+        std::uint32_t slots[Width];
+        int slotCount = 0;
+        const BvhNode& root = binary[binaryIndex];
+        if (root.IsLeaf())
+        {
+            slots[slotCount++] = binaryIndex;
+        }
+        else
+        {
+            slots[slotCount++] = binaryIndex + 1;
+            slots[slotCount++] = root.offset;
+            while (slotCount < Width)
+            {
+                int best = -1;
+                float bestArea = -1.0f;
+                for (int i = 0; i < slotCount; ++i)
+                {
+                    const BvhNode& candidate = binary[slots[i]];
+                    float area = candidate.Bounds().SurfaceArea();
+                    if (!candidate.IsLeaf() && area > bestArea)
+                    {
+                        best = i;
+                        bestArea = area;
+                    }
+                }
+                if (best < 0)
+                {
+                    break;
+                }
+                std::uint32_t opened = slots[best];
+                slots[best] = opened + 1;
+                slots[slotCount++] = binary[opened].offset;
+            }
+        }
+
+        int axis = root.IsLeaf() ? 0 : root.axis;
+        std::sort(slots, slots + slotCount, [&](std::uint32_t a, std::uint32_t b) {
+            return binary[a].Bounds().Centroid()[axis] < binary[b].Bounds().Centroid()[axis];
+        });
+
+        Node& node = nodes[nodeIndex];
+        for (int i = 0; i < Width; ++i)
+        {
+            const bool used = i < slotCount;
+            const BvhNode* child = used ? &binary[slots[i]] : nullptr;
+            constexpr float Infinity = std::numeric_limits<float>::infinity();
+            node.minX[i] = used ? child->boundsMin[0] : Infinity;
+            node.minY[i] = used ? child->boundsMin[1] : Infinity;
+            node.minZ[i] = used ? child->boundsMin[2] : Infinity;
+            node.maxX[i] = used ? child->boundsMax[0] : -Infinity;
+            node.maxY[i] = used ? child->boundsMax[1] : -Infinity;
+            node.maxZ[i] = used ? child->boundsMax[2] : -Infinity;
+            node.child[i] = used && child->IsLeaf() ? child->offset : 0;
+            node.count[i] = used ? child->count : 0;
+        }
+        node.childCount = static_cast<std::uint8_t>(slotCount);
+        node.axis = static_cast<std::uint8_t>(axis);
+
+        for (int i = 0; i < slotCount; ++i)
+        {
+            if (!binary[slots[i]].IsLeaf())
+            {
+                std::uint32_t child = Collapse(binary, slots[i]);
+                nodes[nodeIndex].child[i] = child;
+            }
+        }
+        return nodeIndex;
+    }
+
+    template <int Width>
+    Hit WideBvh<Width>::ClosestHit(const TraversalRay& ray) const
+    {
+        Hit result;
+        if (nodes.empty())
+        {
+            return result;
+        }
+
+        float closest = ray.tMax;
+        std::uint32_t closestSphere = 0;
+
+        struct StackEntry
+        {
+            std::uint32_t node;
+            float tEntry;
+        };
+        StackEntry stack[Bvh::MaxDepth * (Width - 1) + 1];
+        int stackSize = 0;
+        stack[stackSize++] = {0, ray.tMin};
+
+        alignas(32) float tEntry[Width];
+        while (stackSize > 0)
+        {
+            StackEntry entry = stack[--stackSize];
+            if (entry.tEntry > closest)
+            {
+                continue;
+            }
+
+            const Node& node = nodes[entry.node];
+            int mask = IntersectChildren<Width>(node, ray, closest, tEntry);
+            if (mask == 0)
+            {
+                continue;
+            }
+
+            // Children are sorted along node.axis, so a negative direction on that axis reverses front to back order.
+            const bool reverse = ray.sign[node.axis] != 0;
+            const int last = node.childCount - 1;
+
+            // Leaves are intersected front to back right away, which shrinks closest for the interior children.
+            for (int k = 0; k <= last; ++k)
+            {
+                int i = reverse ? last - k : k;
+                if ((mask & (1 << i)) == 0 || node.count[i] == 0 || tEntry[i] > closest)
+                {
+                    continue;
+                }
+                for (std::uint32_t p = node.child[i]; p < node.child[i] + node.count[i]; ++p)
+                {
+                    float t;
+                    if (spheres[p].Intersect(ray.ray, ray.tMin, closest, t))
+                    {
+                        closest = t;
+                        closestSphere = p;
+                        result.hit = true;
+                        result.t = t;
+                        result.primitive = primitiveIndices[p];
+                    }
+                }
+            }
+
+            // Interior children are pushed back to front so that the nearest one is popped first.
+            for (int k = 0; k <= last; ++k)
+            {
+                int i = reverse ? k : last - k;
+                if ((mask & (1 << i)) != 0 && node.count[i] == 0 && tEntry[i] <= closest)
+                {
+                    stack[stackSize++] = {node.child[i], tEntry[i]};
+                }
+            }
+        }
+
+        if (result.hit)
+        {
+            spheres[closestSphere].CompleteHit(ray.ray, result);
+        }
+        return result;
+    }
+
+    template <int Width>
+    bool WideBvh<Width>::Occluded(const TraversalRay& ray) const
+    {
+        if (nodes.empty())
+        {
+            return false;
+        }
+
+        std::uint32_t stack[Bvh::MaxDepth * (Width - 1) + 1];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+
+        alignas(32) float tEntry[Width];
+        while (stackSize > 0)
+        {
+            const Node& node = nodes[stack[--stackSize]];
+            int mask = IntersectChildren<Width>(node, ray, ray.tMax, tEntry);
+            for (int i = 0; i < node.childCount; ++i)
+            {
+                if ((mask & (1 << i)) == 0)
+                {
+                    continue;
+                }
+                if (node.count[i] == 0)
+                {
+                    stack[stackSize++] = node.child[i];
+                    continue;
+                }
+                for (std::uint32_t p = node.child[i]; p < node.child[i] + node.count[i]; ++p)
+                {
+                    if (spheres[p].Occluded(ray.ray, ray.tMin, ray.tMax))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    template class WideBvh<4>;
+    template class WideBvh<8>;
+}
@@ -0,0 +1,50 @@
+#include "RayTracer/Aabb.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[Aabb]";
+
+    TEST_CASE("Aabb default constructor is empty", Tags)
+    {
+        Aabb box;
+
+        REQUIRE(box.IsEmpty());
+        REQUIRE(box.SurfaceArea() == 0.0f);
+    }
+
+    TEST_CASE("Aabb expand by points and boxes", Tags)
+    {
+        Aabb box;
+        box.Expand(Vector3{1.0f, 2.0f, 3.0f});
+        box.Expand(Aabb{{-1.0f, 0.0f, 0.0f}, {0.0f, 4.0f, 1.0f}});
+
+        REQUIRE(box.min == Vector3{-1.0f, 0.0f, 0.0f});
+        REQUIRE(box.max == Vector3{1.0f, 4.0f, 3.0f});
+        REQUIRE(box.Centroid() == Vector3{0.0f, 2.0f, 1.5f});
+        REQUIRE(box.LongestAxis() == 1);
+    }
+
+    TEST_CASE("Aabb surface area", Tags)
+    {
+        Aabb box{{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}};
+
+        REQUIRE(box.SurfaceArea() == 22.0f);
+    }
+
+    TEST_CASE("Aabb ray slab test", Tags)
+    {
+        Aabb box{{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}};
+        constexpr float Infinity = std::numeric_limits<float>::infinity();
+        Vector3 inverseDirection{Infinity, Infinity, 1.0f};
+        float tEntry = 0.0f;
+
+        REQUIRE(box.Intersect({0.0f, 0.0f, -5.0f}, inverseDirection, 0.0f, 100.0f, tEntry));
+        REQUIRE(tEntry == 4.0f);
+        REQUIRE_FALSE(box.Intersect({0.0f, 2.0f, -5.0f}, inverseDirection, 0.0f, 100.0f, tEntry));
+        REQUIRE_FALSE(box.Intersect({0.0f, 0.0f, -5.0f}, inverseDirection, 0.0f, 3.0f, tEntry));
+    }
+}
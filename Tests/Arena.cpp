@@ -0,0 +1,82 @@
+#include "RayTracer/Arena.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[Arena]";
+
+    namespace
+    {
+        bool IsAligned(const void* pointer, std::size_t alignment)
+        {
+            return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+        }
+    }
+
+    TEST_CASE("Arena allocations are aligned and do not overlap", Tags)
+    {
+        Arena arena{256};
+
+        auto* a = static_cast<std::byte*>(arena.allocate(3, 1));
+        auto* b = static_cast<std::byte*>(arena.allocate(16, 16));
+        auto* c = static_cast<std::byte*>(arena.allocate(64, 64));
+
+        REQUIRE(IsAligned(b, 16));
+        REQUIRE(IsAligned(c, 64));
+        REQUIRE(b >= a + 3);
+        REQUIRE(c >= b + 16);
+        REQUIRE(arena.BytesUsed() >= 3 + 16 + 64);
+    }
+
+    TEST_CASE("Arena reset reuses the same memory", Tags)
+    {
+        Arena arena{1024};
+
+        void* first = arena.allocate(100, 8);
+        arena.Reset();
+        REQUIRE(arena.BytesUsed() == 0);
+        REQUIRE(arena.allocate(100, 8) == first);
+    }
+
+    TEST_CASE("Arena grows past its block size and merges blocks on reset", Tags)
+    {
+        Arena arena{128};
+
+        for (int i = 0; i < 10; ++i)
+        {
+            REQUIRE(arena.allocate(100, 8) != nullptr);
+        }
+        void* large = arena.allocate(4096, 256);
+        REQUIRE(IsAligned(large, 256));
+        std::size_t capacity = arena.Capacity();
+        REQUIRE(capacity >= 10 * 100 + 4096);
+
+        arena.Reset();
+        REQUIRE(arena.Capacity() == capacity);
+        for (int i = 0; i < 10; ++i)
+        {
+            REQUIRE(arena.allocate(100, 8) != nullptr);
+        }
+        REQUIRE(arena.allocate(4096, 256) != nullptr);
+        REQUIRE(arena.Capacity() == capacity);
+    }
+
+    TEST_CASE("Arena backs pmr containers", Tags)
+    {
+        Arena arena;
+        ScratchVector<int> values{&arena};
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+
+        REQUIRE(values.size() == 1000);
+        REQUIRE(values[999] == 999);
+        REQUIRE(arena.BytesUsed() >= 1000 * sizeof(int));
+        REQUIRE(arena.is_equal(arena));
+        REQUIRE_FALSE(arena.is_equal(*std::pmr::new_delete_resource()));
+    }
+}
@@ -0,0 +1,243 @@
+#include "RayTracer/Accelerator.hpp"
+#include "RayTracer/Bvh.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+    constexpr const char* Tags = "[Bvh]";
+
+    static_assert(Accelerator<Bvh>);
+    static_assert(PacketAccelerator<Bvh>);
+
+    TEST_CASE("Bvh over no spheres never hits", Tags)
+    {
+        Bvh bvh{std::span<const Sphere>{}};
+
+        REQUIRE(bvh.Nodes().empty());
+        REQUIRE_FALSE(bvh.ClosestHit(Ray{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}).hit);
+    }
+
+    TEST_CASE("Bvh leaves reference every sphere once", Tags)
+    {
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 100; ++i)
+        {
+            spheres.push_back({{static_cast<float>(i), 0.0f, 0.0f}, 0.25f});
+        }
+        Bvh bvh{spheres};
+
+        std::vector<int> references(spheres.size(), 0);
+        for (const BvhNode& node : bvh.Nodes())
+        {
+            if (node.IsLeaf())
+            {
+                REQUIRE(node.count <= Bvh::MaxLeafSize);
+                for (std::uint32_t i = node.offset; i < node.offset + node.count; ++i)
+                {
+                    ++references[bvh.PrimitiveIndices()[i]];
+                }
+            }
+        }
+        for (int count : references)
+        {
+            REQUIRE(count == 1);
+        }
+    }
+
+    TEST_CASE("Bvh closest hit matches brute force", Tags)
+    {
+        std::mt19937 rng{42};
+        std::uniform_real_distribution<float> position{-20.0f, 20.0f};
+        std::uniform_real_distribution<float> size{0.1f, 1.5f};
+
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 1000; ++i)
+        {
+            spheres.push_back({{position(rng), position(rng), position(rng)}, size(rng)});
+        }
+        Bvh bvh{spheres};
+
+        for (int i = 0; i < 200; ++i)
+        {
+            Ray ray{{position(rng), position(rng), position(rng)}, {position(rng), position(rng), position(rng)}};
+
+            Hit expected;
+            for (std::size_t s = 0; s < spheres.size(); ++s)
+            {
+                Hit candidate = spheres[s].Intersect(ray, 0.0f, expected.hit ? expected.t : Infinity);
+                if (candidate.hit && (!expected.hit || candidate.t < expected.t))
+                {
+                    expected = candidate;
+                    expected.primitive = static_cast<std::uint32_t>(s);
+                }
+            }
+
+            Hit hit = bvh.ClosestHit(ray);
+            REQUIRE(hit.hit == expected.hit);
+            if (expected.hit)
+            {
+                REQUIRE(hit.primitive == expected.primitive);
+                REQUIRE(hit.t == expected.t);
+                REQUIRE(hit.position == expected.position);
+                REQUIRE(hit.normal == expected.normal);
+                REQUIRE(hit.frontFace == expected.frontFace);
+            }
+        }
+    }
+
+    TEST_CASE("Bvh handles coincident spheres", Tags)
+    {
+        std::vector<Sphere> spheres(50, Sphere{{0.0f, 0.0f, 0.0f}, 1.0f});
+        Bvh bvh{spheres};
+
+        Hit hit = bvh.ClosestHit(Ray{{0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}});
+        REQUIRE(hit.hit);
+        REQUIRE(hit.t == 4.0f);
+    }
+
+    TEST_CASE("Bvh only reports hits inside the ray interval", Tags)
+    {
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 10; ++i)
+        {
+            spheres.push_back({{static_cast<float>(i), 0.0f, 0.0f}, 0.25f});
+        }
+        Bvh accelerator{spheres};
+        Ray ray{{-5.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, UnitDirection};
+
+        // Sphere 2 spans t = 6.75 to 7.25, so starting at t = 7 hits its far side.
+        Hit hit = accelerator.ClosestHit(TraversalRay{ray, 7.0f});
+        REQUIRE(hit.hit);
+        REQUIRE(hit.primitive == 2);
+        REQUIRE(hit.t == 7.25f);
+
+        REQUIRE_FALSE(accelerator.ClosestHit(TraversalRay{ray, 7.3f, 7.7f}).hit);
+        REQUIRE(accelerator.ClosestHit(TraversalRay{ray, 0.0f, 5.0f}).primitive == 0);
+    }
+
+    TEST_CASE("Bvh occlusion matches brute force", Tags)
+    {
+        std::mt19937 rng{7};
+        std::uniform_real_distribution<float> position{-20.0f, 20.0f};
+        std::uniform_real_distribution<float> size{0.1f, 1.5f};
+        std::uniform_real_distribution<float> distance{0.0f, 30.0f};
+
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 500; ++i)
+        {
+            spheres.push_back({{position(rng), position(rng), position(rng)}, size(rng)});
+        }
+        Bvh accelerator{spheres};
+
+        int occludedCount = 0;
+        for (int i = 0; i < 300; ++i)
+        {
+            Ray ray{{position(rng), position(rng), position(rng)}, {position(rng), position(rng), position(rng)}};
+            float tMax = distance(rng);
+
+            bool expected = false;
+            for (const Sphere& sphere : spheres)
+            {
+                expected = expected || sphere.Occluded(ray, tMax);
+            }
+
+            REQUIRE(accelerator.Occluded(ray, tMax) == expected);
+            occludedCount += expected ? 1 : 0;
+        }
+        REQUIRE(occludedCount > 0);
+        REQUIRE(occludedCount < 300);
+    }
+
+    TEST_CASE("Bvh packet queries match the single ray queries", Tags)
+    {
+        std::mt19937 rng{11};
+        std::uniform_real_distribution<float> position{-20.0f, 20.0f};
+        std::uniform_real_distribution<float> size{0.1f, 1.5f};
+        std::uniform_real_distribution<float> distance{0.0f, 30.0f};
+
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 500; ++i)
+        {
+            spheres.push_back({{position(rng), position(rng), position(rng)}, size(rng)});
+        }
+        Bvh bvh{spheres};
+
+        int hitCount = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            // Lanes share an origin like the paths of a tile, and the last lanes are left inactive in some packets.
+            Vector3 origin{position(rng), position(rng), position(rng)};
+            const int active = i % 3 == 0 ? 5 : RayPacket8::Size;
+            TraversalPacket8 closestPacket;
+            TraversalPacket8 occludedPacket;
+            Ray rays[RayPacket8::Size];
+            float tMax[RayPacket8::Size];
+            for (int lane = 0; lane < active; ++lane)
+            {
+                rays[lane] = Ray{origin, {position(rng), position(rng), position(rng)}};
+                tMax[lane] = distance(rng);
+                closestPacket.Set(lane, rays[lane], 0.01f);
+                occludedPacket.Set(lane, rays[lane], 0.01f, tMax[lane]);
+            }
+
+            Hit hits[RayPacket8::Size];
+            bvh.ClosestHit(closestPacket, hits);
+            const int occluded = bvh.Occluded(occludedPacket);
+            for (int lane = 0; lane < RayPacket8::Size; ++lane)
+            {
+                if (lane >= active)
+                {
+                    REQUIRE_FALSE(hits[lane].hit);
+                    REQUIRE((occluded & (1 << lane)) == 0);
+                    continue;
+                }
+
+                Hit expected = bvh.ClosestHit(TraversalRay{rays[lane], 0.01f});
+                REQUIRE(hits[lane].hit == expected.hit);
+                if (expected.hit)
+                {
+                    REQUIRE(hits[lane].primitive == expected.primitive);
+                    REQUIRE_THAT(hits[lane].t, Catch::Matchers::WithinRel(expected.t, 1e-4f));
+                    REQUIRE(hits[lane].frontFace == expected.frontFace);
+                    ++hitCount;
+                }
+                bool expectedOccluded = bvh.Occluded(TraversalRay{rays[lane], 0.01f, tMax[lane]});
+                REQUIRE(((occluded & (1 << lane)) != 0) == expectedOccluded);
+            }
+        }
+        REQUIRE(hitCount > 0);
+    }
+
+    TEST_CASE("Bvh packet queries skip the near root below tMin", Tags)
+    {
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 10; ++i)
+        {
+            spheres.push_back({{static_cast<float>(i), 0.0f, 0.0f}, 0.25f});
+        }
+        Bvh bvh{spheres};
+        Ray ray{{-5.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, UnitDirection};
+
+        TraversalPacket8 packet;
+        packet.Set(0, ray, 7.0f);
+        packet.Set(1, ray, 7.3f, 7.7f);
+        packet.Set(2, ray, 0.0f, 5.0f);
+        Hit hits[RayPacket8::Size];
+        bvh.ClosestHit(packet, hits);
+
+        REQUIRE(hits[0].hit);
+        REQUIRE(hits[0].primitive == 2);
+        REQUIRE_THAT(hits[0].t, Catch::Matchers::WithinAbs(7.25f, 1e-5f));
+        REQUIRE_FALSE(hits[1].hit);
+        REQUIRE(hits[2].primitive == 0);
+        REQUIRE(bvh.Occluded(packet) == 0b101);
+    }
+}
@@ -0,0 +1,108 @@
+#include "RayTracer/Camera.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[Camera]";
+
+    namespace
+    {
+        void RequireNear(const Vector3& actual, const Vector3& expected)
+        {
+            REQUIRE_THAT(actual.x, Catch::Matchers::WithinAbs(expected.x, 1e-5f));
+            REQUIRE_THAT(actual.y, Catch::Matchers::WithinAbs(expected.y, 1e-5f));
+            REQUIRE_THAT(actual.z, Catch::Matchers::WithinAbs(expected.z, 1e-5f));
+        }
+
+        Camera ExampleCamera()
+        {
+            return Camera{{1.0f, 2.0f, 3.0f}, {-2.0f, 0.5f, -4.0f}, {0.0f, 1.0f, 0.0f}, 0.8f, 75, 41};
+        }
+    }
+
+    TEST_CASE("Camera center ray looks at the target", Tags)
+    {
+        Camera camera{{0.0f, 0.0f, 0.0f}, {3.0f, 4.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, 1.0f, 100, 50};
+        Ray ray = camera.GenerateRay(50.0f, 25.0f);
+
+        REQUIRE(ray.origin == camera.Position());
+        RequireNear(ray.direction, {0.6f, 0.8f, 0.0f});
+    }
+
+    TEST_CASE("Camera matches a pinhole looking down -z", Tags)
+    {
+        constexpr int Width = 64;
+        constexpr int Height = 36;
+        constexpr float FieldOfView = 1.0f;
+        const Vector3 eye{0.0f, 0.0f, 8.0f};
+        Camera camera{eye, eye + Vector3{0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}, FieldOfView, Width, Height};
+
+        const float scale = std::tan(FieldOfView / 2.0f);
+        const float aspect = static_cast<float>(Width) / static_cast<float>(Height);
+        for (int y : {0, 17, Height - 1})
+        {
+            for (int x : {0, 40, Width - 1})
+            {
+                float u = (2.0f * (static_cast<float>(x) + 0.5f) / Width - 1.0f) * aspect * scale;
+                float v = (1.0f - 2.0f * (static_cast<float>(y) + 0.5f) / Height) * scale;
+                Ray expected{eye, {u, v, -1.0f}};
+                RequireNear(camera.GenerateRay(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f).direction,
+                            expected.direction);
+            }
+        }
+    }
+
+    TEST_CASE("Camera batch rays match single rays", Tags)
+    {
+        Camera camera = ExampleCamera();
+        // An odd width exercises the scalar tail after the vector loop.
+        Tile tile{5, 7, 19, 3};
+        std::size_t count = static_cast<std::size_t>(tile.width * tile.height);
+        std::vector<float> x(count);
+        std::vector<float> y(count);
+        std::vector<float> z(count);
+        camera.GenerateRays(tile, {x, y, z});
+
+        for (int row = 0; row < tile.height; ++row)
+        {
+            for (int column = 0; column < tile.width; ++column)
+            {
+                std::size_t i = static_cast<std::size_t>(row * tile.width + column);
+                Ray expected = camera.GenerateRay(static_cast<float>(tile.x + column) + 0.5f,
+                                                  static_cast<float>(tile.y + row) + 0.5f);
+                RequireNear({x[i], y[i], z[i]}, expected.direction);
+                REQUIRE_THAT(Vector3(x[i], y[i], z[i]).Length(), Catch::Matchers::WithinAbs(1.0f, 1e-6f));
+            }
+        }
+    }
+
+    TEST_CASE("Camera packets cover the tile row by row", Tags)
+    {
+        Camera camera = ExampleCamera();
+        Tile tile{3, 2, 11, 2};
+        std::vector<RayPacket8> packets(static_cast<std::size_t>(Camera::PacketCount(tile)));
+        camera.GeneratePackets(tile, packets);
+
+        REQUIRE(Camera::PacketsPerRow(tile) == 2);
+        REQUIRE(packets.size() == 4);
+        for (int p = 0; p < Camera::PacketCount(tile); ++p)
+        {
+            int row = p / Camera::PacketsPerRow(tile);
+            for (int lane = 0; lane < RayPacket8::Size; ++lane)
+            {
+                // Lanes past the end of the row repeat its last pixel.
+                int column = std::min((p % Camera::PacketsPerRow(tile)) * RayPacket8::Size + lane, tile.width - 1);
+                Ray expected = camera.GenerateRay(static_cast<float>(tile.x + column) + 0.5f,
+                                                  static_cast<float>(tile.y + row) + 0.5f);
+                Ray actual = packets[static_cast<std::size_t>(p)].Get(lane);
+                REQUIRE(actual.origin == camera.Position());
+                RequireNear(actual.direction, expected.direction);
+            }
+        }
+    }
+}
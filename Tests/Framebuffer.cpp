@@ -0,0 +1,41 @@
+#include "RayTracer/Framebuffer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[Framebuffer]";
+
+    TEST_CASE("Framebuffer has the requested size", Tags)
+    {
+        Framebuffer framebuffer{13, 7};
+
+        REQUIRE(framebuffer.Width() == 13);
+        REQUIRE(framebuffer.Height() == 7);
+        REQUIRE(framebuffer.Row(3).size() == 13);
+        REQUIRE(framebuffer.Stride() >= 13);
+    }
+
+    TEST_CASE("Framebuffer rows start on cache lines", Tags)
+    {
+        Framebuffer framebuffer{13, 7};
+
+        for (int y = 0; y < framebuffer.Height(); ++y)
+        {
+            auto address = reinterpret_cast<std::uintptr_t>(framebuffer.Row(y).data());
+            REQUIRE(address % Framebuffer::CacheLineSize == 0);
+        }
+    }
+
+    TEST_CASE("Framebuffer pixel access", Tags)
+    {
+        Framebuffer framebuffer{4, 4};
+        framebuffer.Clear({0.5f, 0.5f, 0.5f});
+        framebuffer.At(2, 1) = {1.0f, 0.0f, 0.0f};
+
+        REQUIRE(framebuffer.Row(1)[2] == Color{1.0f, 0.0f, 0.0f});
+        REQUIRE(framebuffer.At(3, 3) == Color{0.5f, 0.5f, 0.5f});
+    }
+}
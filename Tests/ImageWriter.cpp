@@ -0,0 +1,65 @@
+#include "RayTracer/ImageWriter.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[ImageWriter]";
+
+    TEST_CASE("ImageWriter picks the format from the extension", Tags)
+    {
+        REQUIRE(ImageWriter::FormatFromPath("image.pfm") == ImageFormat::Pfm);
+        REQUIRE(ImageWriter::FormatFromPath("image.ppm") == ImageFormat::Ppm);
+        REQUIRE(ImageWriter::FormatFromPath("image") == ImageFormat::Ppm);
+    }
+
+    TEST_CASE("ImageWriter writes PPM rows in any order", Tags)
+    {
+        Framebuffer framebuffer{2, 2};
+        framebuffer.At(0, 0) = {1.0f, 0.0f, 0.0f};
+        framebuffer.At(1, 0) = {0.0f, 1.0f, 0.0f};
+        framebuffer.At(0, 1) = {0.0f, 0.0f, 2.0f};
+        framebuffer.At(1, 1) = {-1.0f, 1.0f, 1.0f};
+
+        std::stringstream stream;
+        ImageWriter writer{stream, ImageFormat::Ppm, 2, 2};
+        writer.WriteRows(framebuffer, 1, 1);
+        REQUIRE_FALSE(writer.Complete());
+        writer.WriteRows(framebuffer, 0, 1);
+        REQUIRE(writer.Complete());
+
+        std::string header = "P6\n2 2\n255\n";
+        std::string data = stream.str();
+        REQUIRE(data.size() == header.size() + 12);
+        REQUIRE(data.substr(0, header.size()) == header);
+
+        const unsigned char expected[12] = {255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 255, 255};
+        REQUIRE(std::memcmp(data.data() + header.size(), expected, sizeof(expected)) == 0);
+    }
+
+    TEST_CASE("ImageWriter writes PFM rows bottom to top", Tags)
+    {
+        Framebuffer framebuffer{1, 2};
+        framebuffer.At(0, 0) = {0.25f, 0.5f, 4.0f};
+        framebuffer.At(0, 1) = {1.0f, 2.0f, 3.0f};
+
+        std::stringstream stream;
+        ImageWriter writer{stream, ImageFormat::Pfm, 1, 2};
+        writer.WriteRows(framebuffer, 0, 2);
+
+        std::string data = stream.str();
+        std::size_t headerSize = data.size() - 2 * 3 * sizeof(float);
+        REQUIRE(data.substr(0, 3) == "PF\n");
+
+        float values[6];
+        std::memcpy(values, data.data() + headerSize, sizeof(values));
+        REQUIRE(values[0] == 1.0f);
+        REQUIRE(values[2] == 3.0f);
+        REQUIRE(values[3] == 0.25f);
+        REQUIRE(values[5] == 4.0f);
+    }
+}
@@ -0,0 +1,156 @@
+#include "RayTracer/Accelerator.hpp"
+#include "RayTracer/InstancedScene.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <random>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[InstancedScene]";
+
+    static_assert(Accelerator<InstancedScene>);
+
+    namespace
+    {
+        Bvh UnitSphere()
+        {
+            Sphere sphere{{0.0f, 0.0f, 0.0f}, 1.0f};
+            return Bvh{std::span<const Sphere>{&sphere, 1}};
+        }
+
+        void RequireNear(const Vector3& actual, const Vector3& expected)
+        {
+            REQUIRE_THAT(actual.x, Catch::Matchers::WithinAbs(expected.x, 1e-4f));
+            REQUIRE_THAT(actual.y, Catch::Matchers::WithinAbs(expected.y, 1e-4f));
+            REQUIRE_THAT(actual.z, Catch::Matchers::WithinAbs(expected.z, 1e-4f));
+        }
+    }
+
+    TEST_CASE("InstancedScene without instances never hits", Tags)
+    {
+        InstancedScene scene{{UnitSphere()}, {}};
+        Ray ray{{0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}};
+
+        REQUIRE(scene.Nodes().empty());
+        REQUIRE_FALSE(scene.ClosestHit(ray).hit);
+        REQUIRE_FALSE(scene.Occluded(ray, 100.0f));
+    }
+
+    TEST_CASE("InstancedScene identity instance matches its geometry", Tags)
+    {
+        std::vector<Sphere> spheres = {{{0.0f, 0.0f, 0.0f}, 1.0f}, {{3.0f, 0.0f, 0.0f}, 0.5f}};
+        Bvh bvh{spheres};
+        InstancedScene scene{{bvh}, {{0, Transform{}}}};
+        Ray ray{{3.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}};
+
+        Hit expected = bvh.ClosestHit(ray);
+        Hit actual = scene.ClosestHit(ray);
+        REQUIRE(actual.hit);
+        REQUIRE(actual.instance == 0);
+        REQUIRE(actual.primitive == expected.primitive);
+        REQUIRE_THAT(actual.t, Catch::Matchers::WithinAbs(expected.t, 1e-5f));
+        RequireNear(actual.position, expected.position);
+        RequireNear(actual.normal, expected.normal);
+        REQUIRE(actual.frontFace == expected.frontFace);
+    }
+
+    TEST_CASE("InstancedScene hit distances and normals are in world space", Tags)
+    {
+        SECTION("Scaled and translated")
+        {
+            Transform transform = Transform::Scaling({2.0f, 2.0f, 2.0f}) * Transform::Translation({10.0f, 0.0f, 0.0f});
+            InstancedScene scene{{UnitSphere()}, {{0, transform}}};
+
+            Hit hit = scene.ClosestHit(Ray{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}});
+            REQUIRE(hit.hit);
+            REQUIRE_THAT(hit.t, Catch::Matchers::WithinAbs(8.0f, 1e-4f));
+            RequireNear(hit.position, {8.0f, 0.0f, 0.0f});
+            RequireNear(hit.normal, {-1.0f, 0.0f, 0.0f});
+            REQUIRE(hit.frontFace);
+        }
+
+        SECTION("Non-uniform scaling makes an ellipsoid")
+        {
+            InstancedScene scene{{UnitSphere()}, {{0, Transform::Scaling({1.0f, 3.0f, 1.0f})}}};
+
+            Hit hit = scene.ClosestHit(Ray{{0.0f, 10.0f, 0.0f}, {0.0f, -1.0f, 0.0f}});
+            REQUIRE(hit.hit);
+            REQUIRE_THAT(hit.t, Catch::Matchers::WithinAbs(7.0f, 1e-4f));
+            RequireNear(hit.normal, {0.0f, 1.0f, 0.0f});
+
+            // Off the axis the normal follows the inverse-transpose rather than the direction from the center.
+            Vector3 surface{0.6f, 2.4f, 0.0f};
+            hit = scene.ClosestHit(Ray{surface + Vector3{5.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}});
+            REQUIRE(hit.hit);
+            REQUIRE_THAT(hit.t, Catch::Matchers::WithinAbs(5.0f, 1e-3f));
+            RequireNear(hit.position, surface);
+            RequireNear(hit.normal, Vector3{0.6f, 0.8f / 3.0f, 0.0f}.Normalized());
+        }
+
+        SECTION("Inside an instance")
+        {
+            InstancedScene scene{{UnitSphere()}, {{0, Transform::Scaling({4.0f, 4.0f, 4.0f})}}};
+
+            Hit hit = scene.ClosestHit(Ray{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}});
+            REQUIRE(hit.hit);
+            REQUIRE_THAT(hit.t, Catch::Matchers::WithinAbs(4.0f, 1e-4f));
+            RequireNear(hit.normal, {0.0f, 0.0f, -1.0f});
+            REQUIRE_FALSE(hit.frontFace);
+        }
+    }
+
+    TEST_CASE("InstancedScene matches a flat Bvh over the placed spheres", Tags)
+    {
+        std::mt19937 rng{42};
+        std::uniform_real_distribution<float> position{-20.0f, 20.0f};
+        std::uniform_real_distribution<float> scale{0.5f, 2.0f};
+        std::uniform_real_distribution<float> unit{-1.0f, 1.0f};
+
+        std::vector<Sphere> shapes[2] = {{{{0.0f, 0.0f, 0.0f}, 1.0f}},
+                                         {{{-1.0f, 0.0f, 0.0f}, 0.5f}, {{1.0f, 0.0f, 0.0f}, 0.5f}}};
+        std::vector<Bvh> geometries = {Bvh{shapes[0]}, Bvh{shapes[1]}};
+
+        std::vector<Instance> instances;
+        std::vector<Sphere> world;
+        std::vector<std::uint32_t> worldInstance;
+        for (std::uint32_t i = 0; i < 200; ++i)
+        {
+            std::uint32_t geometry = i % 2;
+            float s = scale(rng);
+            Vector3 offset{position(rng), position(rng), position(rng)};
+            instances.push_back({geometry, Transform::Scaling({s, s, s}) * Transform::RotationY(unit(rng) * 3.0f) *
+                                               Transform::Translation(offset)});
+            for (const Sphere& sphere : shapes[geometry])
+            {
+                world.push_back({instances.back().transform.TransformPoint(sphere.center), sphere.radius * s});
+                worldInstance.push_back(i);
+            }
+        }
+
+        InstancedScene scene{geometries, instances};
+        Bvh flat{world};
+
+        for (int r = 0; r < 500; ++r)
+        {
+            Vector3 origin{position(rng), position(rng), position(rng)};
+            Ray ray{origin, Vector3{unit(rng), unit(rng), unit(rng)}.Normalized()};
+
+            Hit expected = flat.ClosestHit(ray);
+            Hit actual = scene.ClosestHit(ray);
+            REQUIRE(actual.hit == expected.hit);
+            if (expected.hit)
+            {
+                // Object space intersection rounds differently, which shows most on grazing hits.
+                REQUIRE_THAT(actual.t, Catch::Matchers::WithinRel(expected.t, 1e-3f));
+                REQUIRE(actual.instance == worldInstance[expected.primitive]);
+                REQUIRE(actual.normal.Dot(expected.normal) > 0.99f);
+            }
+
+            float tMax = position(rng) + 20.0f;
+            REQUIRE(scene.Occluded(ray, tMax) == flat.Occluded(ray, tMax));
+        }
+    }
+}
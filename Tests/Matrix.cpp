@@ -1,12 +1,59 @@
 #include "RayTracer/Matrix.hpp"
+#include "RayTracer/ThreadPool.hpp"
 #include "RayTracer/Vector4.hpp"
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <vector>
 
 namespace RayTracer::Tests
 {
     constexpr const char* Tags = "[Matrix]";
 
+    namespace
+    {
+        // A matrix with no zero or repeated structure, including a non-affine bottom row.
+        Matrix GeneralMatrix()
+        {
+            Matrix matrix;
+            const float values[16] = {2.0f, -1.0f, 0.5f, 0.25f, 1.0f, 3.0f, -2.0f, 0.5f,
+                                      0.0f, 1.5f, 4.0f, -1.0f, 3.0f,  -2.0f, 1.0f, 2.0f};
+            for (int i = 0; i < 16; ++i)
+            {
+                matrix.elements[i] = values[i];
+            }
+            return matrix;
+        }
+
+        // An odd count so that the SIMD kernels also run their scalar tails.
+        std::vector<Vector3> TestPoints(std::size_t count)
+        {
+            std::vector<Vector3> points;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                float f = static_cast<float>(i);
+                points.push_back({f * 0.5f - 3.0f, 2.0f - f * 0.25f, f * f * 0.01f});
+            }
+            return points;
+        }
+
+        void RequireNear(const Vector3& actual, const Vector4& expected)
+        {
+            REQUIRE_THAT(actual.x, Catch::Matchers::WithinAbs(expected.x, 1e-3f));
+            REQUIRE_THAT(actual.y, Catch::Matchers::WithinAbs(expected.y, 1e-3f));
+            REQUIRE_THAT(actual.z, Catch::Matchers::WithinAbs(expected.z, 1e-3f));
+        }
+
+        void RequireNear(const Matrix& actual, const Matrix& expected, float margin)
+        {
+            for (int i = 0; i < 16; ++i)
+            {
+                REQUIRE_THAT(actual.elements[i], Catch::Matchers::WithinAbs(expected.elements[i], margin));
+            }
+        }
+    }
+
     TEST_CASE("Matrix can be created with default constructor", Tags)
     {
         Matrix matrix;
@@ -109,6 +156,41 @@ namespace RayTracer::Tests
         REQUIRE(result.elements[15] == 2.0f);
     }
 
+    TEST_CASE("Matrix multiplication applies the left operand first", Tags)
+    {
+        Matrix a = GeneralMatrix();
+        Matrix b = Matrix::RotationX(0.3f) * Matrix::Translation({1.0f, -2.0f, 3.0f});
+        Vector4 point{0.5f, -1.5f, 2.0f, 1.0f};
+
+        Vector4 composed = (a * b) * point;
+        Vector4 sequential = b * (a * point);
+
+        REQUIRE_THAT(composed.x, Catch::Matchers::WithinAbs(sequential.x, 1e-5f));
+        REQUIRE_THAT(composed.y, Catch::Matchers::WithinAbs(sequential.y, 1e-5f));
+        REQUIRE_THAT(composed.z, Catch::Matchers::WithinAbs(sequential.z, 1e-5f));
+        REQUIRE_THAT(composed.w, Catch::Matchers::WithinAbs(sequential.w, 1e-5f));
+    }
+
+    TEST_CASE("Matrix multiplication matches the definition", Tags)
+    {
+        Matrix a = GeneralMatrix();
+        Matrix b = GeneralMatrix().Transpose() * 0.5f;
+        Matrix result = a * b;
+
+        Matrix expected;
+        for (int c = 0; c < 4; ++c)
+        {
+            for (int r = 0; r < 4; ++r)
+            {
+                for (int k = 0; k < 4; ++k)
+                {
+                    expected(r, c) += a(k, c) * b(r, k);
+                }
+            }
+        }
+        RequireNear(result, expected, 1e-5f);
+    }
+
     TEST_CASE("Matrix vector multiplication", Tags)
     {
         Matrix matrix{1.0f};
@@ -121,6 +203,103 @@ namespace RayTracer::Tests
         REQUIRE(result.w == 4.0f);
     }
 
+    TEST_CASE("Matrix transforms arrays of points and directions", Tags)
+    {
+        Matrix matrix = GeneralMatrix();
+        std::vector<Vector3> points = TestPoints(37);
+        std::vector<Vector3> transformedPoints(points.size());
+        std::vector<Vector3> transformedDirections(points.size());
+
+        matrix.TransformPoints(points, transformedPoints);
+        matrix.TransformDirections(points, transformedDirections);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            Vector4 point = matrix * Vector4{points[i], 1.0f};
+            Vector4 direction = matrix * Vector4{points[i], 0.0f};
+            RequireNear(transformedPoints[i], point);
+            RequireNear(transformedDirections[i], direction);
+        }
+    }
+
+    TEST_CASE("Matrix transforms points in place", Tags)
+    {
+        Matrix matrix = Matrix::Translation({1.0f, 2.0f, 3.0f});
+        std::vector<Vector3> points = TestPoints(5);
+        std::vector<Vector3> expected = points;
+
+        matrix.TransformPoints(points, points);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(points[i] == expected[i] + Vector3{1.0f, 2.0f, 3.0f});
+        }
+    }
+
+    TEST_CASE("Matrix transforms coordinate arrays", Tags)
+    {
+        Matrix matrix = GeneralMatrix();
+        std::vector<Vector3> points = TestPoints(37);
+        std::vector<float> x, y, z;
+        for (const Vector3& point : points)
+        {
+            x.push_back(point.x);
+            y.push_back(point.y);
+            z.push_back(point.z);
+        }
+        std::vector<float> outX(points.size()), outY(points.size()), outZ(points.size());
+
+        matrix.TransformPoints(ConstVector3Arrays{x, y, z}, Vector3Arrays{outX, outY, outZ});
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            RequireNear({outX[i], outY[i], outZ[i]}, matrix * Vector4{points[i], 1.0f});
+        }
+
+        matrix.TransformDirections(ConstVector3Arrays{x, y, z}, Vector3Arrays{outX, outY, outZ});
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            RequireNear({outX[i], outY[i], outZ[i]}, matrix * Vector4{points[i], 0.0f});
+        }
+    }
+
+    TEST_CASE("Matrix parallel transforms match the serial ones", Tags)
+    {
+        ThreadPool pool{4};
+        Matrix matrix = GeneralMatrix();
+        std::vector<Vector3> points = TestPoints(100001);
+        std::vector<Vector3> serial(points.size());
+        std::vector<Vector3> parallel(points.size());
+
+        matrix.TransformPoints(points, serial);
+        matrix.TransformPoints(pool, points, parallel);
+        REQUIRE(serial == parallel);
+
+        matrix.TransformDirections(points, serial);
+        matrix.TransformDirections(pool, points, parallel);
+        REQUIRE(serial == parallel);
+
+        std::vector<float> x(points.size(), 1.0f), y(points.size(), 2.0f), z(points.size(), 3.0f);
+        matrix.TransformPoints(pool, ConstVector3Arrays{x, y, z}, Vector3Arrays{x, y, z});
+        Vector4 expected = matrix * Vector4{1.0f, 2.0f, 3.0f, 1.0f};
+        RequireNear({x.front(), y.front(), z.front()}, expected);
+        RequireNear({x.back(), y.back(), z.back()}, expected);
+    }
+
+    TEST_CASE("Matrix parallel transforms can run inside a pool task", Tags)
+    {
+        // With a single worker busy running the outer task, waiting for the pool to go idle would never return.
+        ThreadPool pool{1};
+        Matrix matrix = GeneralMatrix();
+        std::vector<Vector3> points = TestPoints(100001);
+        std::vector<Vector3> serial(points.size());
+        std::vector<Vector3> parallel(points.size());
+        matrix.TransformPoints(points, serial);
+
+        pool.Submit([&](unsigned) { matrix.TransformPoints(pool, points, parallel); });
+        pool.Wait();
+        REQUIRE(serial == parallel);
+    }
+
     TEST_CASE("Matrix transpose", Tags)
     {
         Matrix matrix;
@@ -174,6 +353,32 @@ namespace RayTracer::Tests
         REQUIRE(product == Matrix::Identity());
     }
 
+    TEST_CASE("Matrix inverse of a general matrix", Tags)
+    {
+        Matrix matrix = GeneralMatrix();
+        Matrix inv = matrix.Inverse();
+
+        RequireNear(matrix * inv, Matrix::Identity(), 1e-5f);
+        RequireNear(inv * matrix, Matrix::Identity(), 1e-5f);
+    }
+
+    TEST_CASE("Matrix inverse of a transform", Tags)
+    {
+        Matrix transform = Matrix::Scaling({2.0f, 0.5f, 3.0f}) * Matrix::RotationY(1.1f) *
+                           Matrix::Shear(0.5f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f) *
+                           Matrix::Translation({10.0f, -4.0f, 7.0f});
+        Matrix inv = transform.Inverse();
+
+        RequireNear(transform * inv, Matrix::Identity(), 1e-5f);
+        RequireNear(inv.Inverse(), transform, 1e-4f);
+    }
+
+    TEST_CASE("Matrix inverse of a singular matrix is the identity", Tags)
+    {
+        Matrix singular = Matrix::Scaling({1.0f, 0.0f, 1.0f});
+        REQUIRE(singular.Inverse() == Matrix::Identity());
+    }
+
     TEST_CASE("Matrix translation", Tags)
     {
         Vector3 trans{1.0f, 2.0f, 3.0f};
@@ -0,0 +1,37 @@
+#include "RayTracer/Morton.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[Morton]";
+
+    static_assert(MortonEncode(0, 0) == 0);
+    static_assert(MortonEncode(1, 0) == 1);
+    static_assert(MortonEncode(0, 1) == 2);
+    static_assert(MortonEncode(3, 5) == 0b100111);
+    static_assert(MortonEncode(0xFFFF, 0xFFFF) == 0xFFFFFFFF);
+
+    static_assert(MortonEncode(1, 0, 0) == 1);
+    static_assert(MortonEncode(0, 1, 0) == 2);
+    static_assert(MortonEncode(0, 0, 1) == 4);
+    static_assert(MortonEncode(3, 0, 1) == 0b001101);
+    static_assert(MortonEncode(0x3FF, 0x3FF, 0x3FF) == 0x3FFFFFFF);
+
+    TEST_CASE("Morton decode inverts encode", Tags)
+    {
+        for (std::uint32_t y = 0; y < 300; y += 7)
+        {
+            for (std::uint32_t x = 0; x < 70000; x += 997)
+            {
+                std::uint32_t decodedX;
+                std::uint32_t decodedY;
+                MortonDecode(MortonEncode(x % 65536, y), decodedX, decodedY);
+                REQUIRE(decodedX == x % 65536);
+                REQUIRE(decodedY == y);
+            }
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "RayTracer/Sphere.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    /**
+     * Where RandomSpheres places its spheres: centers uniform in [-extent, extent] on every axis and radii uniform in
+     * [minRadius, maxRadius].
+     */
+    struct SphereRange
+    {
+        float extent = 20.0f;
+        float minRadius = 0.1f;
+        float maxRadius = 1.5f;
+    };
+
+    /**
+     * count spheres drawn from rng, which continues where it stopped so that a test can draw rays after the scene.
+     */
+    inline std::vector<Sphere> RandomSpheres(std::mt19937& rng, int count, const SphereRange& range = {})
+    {
+        std::uniform_real_distribution<float> position{-range.extent, range.extent};
+        std::uniform_real_distribution<float> size{range.minRadius, range.maxRadius};
+        std::vector<Sphere> spheres;
+        spheres.reserve(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i)
+        {
+            spheres.push_back({{position(rng), position(rng), position(rng)}, size(rng)});
+        }
+        return spheres;
+    }
+
+    inline std::vector<Sphere> RandomSpheres(std::uint32_t seed, int count, const SphereRange& range = {})
+    {
+        std::mt19937 rng{seed};
+        return RandomSpheres(rng, count, range);
+    }
+}
@@ -33,4 +33,13 @@ namespace RayTracer::Tests
         Vector3 point = ray.At(2.0f);
         REQUIRE(point == Vector3{2.0f, 0.0f, 0.0f});
     }
+
+    TEST_CASE("Ray with a unit direction skips normalization", Tags)
+    {
+        // Slightly off unit length, so normalizing would change it.
+        Vector3 direction{0.0f, 0.0f, 1.0001f};
+        Ray ray{{0.0f, 0.0f, 0.0f}, direction, UnitDirection};
+
+        REQUIRE(ray.direction.z == direction.z);
+    }
 }
@@ -0,0 +1,33 @@
+#include "RayTracer/RayPacket.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[RayPacket]";
+
+    TEST_CASE("RayPacket8 can be created with default constructor", Tags)
+    {
+        RayPacket8 packet;
+
+        for (int lane = 0; lane < RayPacket8::Size; ++lane)
+        {
+            Ray ray = packet.Get(lane);
+            REQUIRE(ray.origin == Vector3{0.0f, 0.0f, 0.0f});
+            REQUIRE(ray.direction == Vector3{0.0f, 0.0f, 1.0f});
+        }
+    }
+
+    TEST_CASE("RayPacket8 set and get lanes", Tags)
+    {
+        RayPacket8 packet;
+        Ray ray{{1.0f, 2.0f, 3.0f}, {0.0f, 2.0f, 0.0f}};
+        packet.Set(5, ray);
+
+        REQUIRE(packet.originX[5] == 1.0f);
+        REQUIRE(packet.originY[5] == 2.0f);
+        REQUIRE(packet.originZ[5] == 3.0f);
+        REQUIRE(packet.Get(5).direction == Vector3{0.0f, 1.0f, 0.0f});
+        REQUIRE(packet.Get(4).origin == Vector3{0.0f, 0.0f, 0.0f});
+    }
+}
@@ -0,0 +1,102 @@
+#include "RayTracer/RaySort.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[RaySort]";
+
+    namespace
+    {
+        const Aabb UnitBounds{{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+    }
+
+    TEST_CASE("RadixSort sorts keys stably", Tags)
+    {
+        std::mt19937 generator{7};
+        for (int keyBits : {8, RaySortKey::Bits, 32})
+        {
+            std::uniform_int_distribution<std::uint32_t> distribution{
+                0, keyBits == 32 ? 0xFFFFFFFFu : (1u << keyBits) - 1};
+            std::vector<std::uint32_t> keys(5000);
+            for (std::uint32_t& key : keys)
+            {
+                key = distribution(generator);
+            }
+            std::vector<std::uint32_t> values(keys.size());
+            std::iota(values.begin(), values.end(), 0u);
+
+            std::vector<std::uint32_t> expected = values;
+            std::stable_sort(expected.begin(), expected.end(),
+                             [&](std::uint32_t a, std::uint32_t b) { return keys[a] < keys[b]; });
+
+            std::vector<std::uint32_t> sortedKeys = keys;
+            std::vector<std::uint32_t> keyScratch(keys.size());
+            std::vector<std::uint32_t> valueScratch(keys.size());
+            RadixSort(sortedKeys, values, keyScratch, valueScratch, keyBits);
+
+            REQUIRE(values == expected);
+            REQUIRE(std::is_sorted(sortedKeys.begin(), sortedKeys.end()));
+        }
+    }
+
+    TEST_CASE("RadixSort handles empty and uniform input", Tags)
+    {
+        std::vector<std::uint32_t> empty;
+        RadixSort(empty, empty, empty, empty);
+
+        std::vector<std::uint32_t> keys(100, 0x12345u);
+        std::vector<std::uint32_t> values(keys.size());
+        std::iota(values.begin(), values.end(), 0u);
+        std::vector<std::uint32_t> keyScratch(keys.size());
+        std::vector<std::uint32_t> valueScratch(keys.size());
+        RadixSort(keys, values, keyScratch, valueScratch);
+        REQUIRE(std::is_sorted(values.begin(), values.end()));
+    }
+
+    TEST_CASE("RaySortKey groups rays by octant first", Tags)
+    {
+        RaySortKey key{UnitBounds};
+        std::uint32_t positive = key({1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f});
+        std::uint32_t negativeX = key({0.0f, 0.0f, 0.0f}, {-1.0f, 1.0f, 1.0f});
+        std::uint32_t negativeZ = key({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, -1.0f});
+
+        REQUIRE(positive < negativeX);
+        REQUIRE(negativeX < negativeZ);
+        REQUIRE(positive >> (3 * RaySortKey::OriginBits) == 0);
+        REQUIRE(negativeZ >> (3 * RaySortKey::OriginBits) == 4);
+        REQUIRE(positive < (1u << RaySortKey::Bits));
+    }
+
+    TEST_CASE("RaySortKey orders origins along a Morton curve", Tags)
+    {
+        RaySortKey key{UnitBounds};
+        const Vector3 direction{0.0f, 1.0f, 0.0f};
+        constexpr std::uint32_t Largest = (1u << RaySortKey::OriginBits) - 1;
+
+        REQUIRE(key({0.0f, 0.0f, 0.0f}, direction) == 0);
+        REQUIRE(key({1.0f, 1.0f, 1.0f}, direction) == MortonEncode(Largest, Largest, Largest));
+        REQUIRE(key({0.5f, 0.0f, 0.0f}, direction) == MortonEncode(Largest / 2 + 1, 0, 0));
+
+        // Origins outside the bounds are clamped.
+        REQUIRE(key({-3.0f, 0.0f, 7.0f}, direction) == MortonEncode(0, 0, Largest));
+
+        // z holds the most significant bit of every triple, so the halves along z are split first.
+        REQUIRE(key({0.99f, 0.99f, 0.49f}, direction) < key({0.0f, 0.0f, 0.51f}, direction));
+    }
+
+    TEST_CASE("RaySortKey tolerates flat bounds", Tags)
+    {
+        RaySortKey flat{Aabb{{0.0f, 2.0f, 0.0f}, {1.0f, 2.0f, 1.0f}}};
+        REQUIRE(flat({1.0f, 2.0f, 1.0f}, {1.0f, 1.0f, 1.0f}) == MortonEncode(511, 0, 511));
+
+        RaySortKey empty{Aabb{}};
+        REQUIRE(empty({5.0f, 5.0f, 5.0f}, {1.0f, 1.0f, 1.0f}) == 0);
+    }
+}
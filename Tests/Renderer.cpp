@@ -0,0 +1,173 @@
+#include "RayTracer/Renderer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[Renderer]";
+
+    TEST_CASE("Renderer splits the image into clipped tiles", Tags)
+    {
+        std::vector<Tile> tiles = Renderer::SplitTiles(70, 40, 32);
+
+        REQUIRE(tiles.size() == 6);
+        REQUIRE(tiles[2].x == 64);
+        REQUIRE(tiles[2].width == 6);
+        REQUIRE(tiles[5].y == 32);
+        REQUIRE(tiles[5].height == 8);
+    }
+
+    TEST_CASE("Renderer sorts tiles along the Morton curve", Tags)
+    {
+        std::vector<Tile> tiles = Renderer::SplitTiles(70, 40, 32, PixelOrder::Morton);
+
+        REQUIRE(tiles.size() == 6);
+        // The first 2x2 block of tiles comes first, then the clipped column on the right.
+        REQUIRE((tiles[0].x == 0 && tiles[0].y == 0));
+        REQUIRE((tiles[1].x == 32 && tiles[1].y == 0));
+        REQUIRE((tiles[2].x == 0 && tiles[2].y == 32));
+        REQUIRE((tiles[3].x == 32 && tiles[3].y == 32));
+        REQUIRE((tiles[4].x == 64 && tiles[4].y == 0));
+        REQUIRE((tiles[5].x == 64 && tiles[5].y == 32));
+    }
+
+    TEST_CASE("ForEachPixel visits every pixel of a tile once in either order", Tags)
+    {
+        Tile tile{10, 20, 13, 6};
+        for (PixelOrder order : {PixelOrder::Scanline, PixelOrder::Morton})
+        {
+            std::vector<int> visits(static_cast<std::size_t>(tile.width * tile.height), 0);
+            std::vector<std::pair<int, int>> sequence;
+            ForEachPixel(tile, order, [&](int x, int y) {
+                ++visits[static_cast<std::size_t>((y - tile.y) * tile.width + (x - tile.x))];
+                sequence.emplace_back(x - tile.x, y - tile.y);
+            });
+
+            for (int count : visits)
+            {
+                REQUIRE(count == 1);
+            }
+            if (order == PixelOrder::Morton)
+            {
+                REQUIRE(sequence[1] == std::pair{1, 0});
+                REQUIRE(sequence[2] == std::pair{0, 1});
+                REQUIRE(sequence[3] == std::pair{1, 1});
+            }
+            else
+            {
+                REQUIRE(sequence[1] == std::pair{1, 0});
+                REQUIRE(sequence[2] == std::pair{2, 0});
+            }
+        }
+    }
+
+    TEST_CASE("Renderer visits every pixel exactly once", Tags)
+    {
+        constexpr int Width = 100;
+        constexpr int Height = 75;
+        ThreadPool pool{4};
+        Renderer renderer{pool, 16};
+        std::vector<std::atomic<int>> visits(Width * Height);
+
+        RenderStats stats = renderer.Render(Width, Height, [&](const Tile& tile, unsigned) {
+            for (int y = tile.y; y < tile.y + tile.height; ++y)
+            {
+                for (int x = tile.x; x < tile.x + tile.width; ++x)
+                {
+                    ++visits[y * Width + x];
+                }
+            }
+        });
+
+        for (const auto& count : visits)
+        {
+            REQUIRE(count == 1);
+        }
+        // One entry per worker and one for the calling thread.
+        REQUIRE(stats.workers.size() == 5);
+        std::uint64_t tiles = 0;
+        for (unsigned worker = 0; worker < stats.workers.size(); ++worker)
+        {
+            tiles += stats.workers[worker].tasks;
+            REQUIRE(stats.Utilization(worker) <= 1.0);
+        }
+        REQUIRE(tiles == 35);
+    }
+
+    TEST_CASE("Renderer resets the scratch arena after every tile", Tags)
+    {
+        ThreadPool pool{4};
+        Renderer renderer{pool, 16};
+        std::atomic<int> dirtyTiles = 0;
+
+        renderer.Render(64, 64, [&](const Tile& tile, unsigned worker) {
+            Arena& scratch = renderer.Scratch(worker);
+            if (scratch.BytesUsed() != 0)
+            {
+                ++dirtyTiles;
+            }
+            ScratchVector<float> samples{static_cast<std::size_t>(tile.width * tile.height), &scratch};
+            samples[0] = 1.0f;
+        });
+
+        REQUIRE(dirtyTiles == 0);
+        for (unsigned worker = 0; worker <= pool.ThreadCount(); ++worker)
+        {
+            REQUIRE(renderer.Scratch(worker).BytesUsed() == 0);
+        }
+    }
+
+    TEST_CASE("Renderer can render from inside a pool task", Tags)
+    {
+        // With a single worker busy running the outer task, waiting for the pool to go idle would never return.
+        ThreadPool pool{1};
+        Renderer renderer{pool, 16};
+        std::atomic<int> tiles = 0;
+        std::atomic<bool> workerIndexValid = true;
+
+        pool.Submit([&](unsigned outer) {
+            renderer.Render(64, 48, [&](const Tile&, unsigned worker) {
+                if (worker != outer)
+                {
+                    workerIndexValid = false;
+                }
+                ++tiles;
+            });
+        });
+        pool.Wait();
+
+        REQUIRE(tiles == 12);
+        REQUIRE(workerIndexValid);
+    }
+
+    TEST_CASE("Renderer leaves the pool statistics of other users alone", Tags)
+    {
+        ThreadPool pool{2};
+        for (int i = 0; i < 10; ++i)
+        {
+            pool.Submit([](unsigned) {});
+        }
+        pool.Wait();
+
+        Renderer renderer{pool, 16};
+        RenderStats stats = renderer.Render(64, 64, [](const Tile&, unsigned) {});
+
+        std::uint64_t poolTasks = 0;
+        for (const ThreadPool::WorkerStats& worker : pool.Stats())
+        {
+            poolTasks += worker.tasks;
+        }
+        REQUIRE(poolTasks >= 10);
+        std::uint64_t tiles = 0;
+        for (const ThreadPool::WorkerStats& worker : stats.workers)
+        {
+            tiles += worker.tasks;
+        }
+        REQUIRE(tiles == 16);
+    }
+}
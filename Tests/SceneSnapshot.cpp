@@ -0,0 +1,227 @@
+#include "RayTracer/Accelerator.hpp"
+#include "RayTracer/SceneSnapshot.hpp"
+
+#include "RandomSpheres.hpp"
+#include "TemporaryFile.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[SceneSnapshot]";
+
+    static_assert(Accelerator<BvhView>);
+
+    namespace
+    {
+        void WriteSnapshot(const std::filesystem::path& path, const SphereSoA& soa, const Bvh& bvh,
+                           std::span<const Instance> instances)
+        {
+            std::ofstream stream{path, std::ios::binary};
+            SceneSnapshot::Write(stream, soa.View(), bvh.View(), instances);
+            REQUIRE(stream);
+        }
+
+        std::vector<char> ReadBytes(const std::filesystem::path& path)
+        {
+            std::ifstream stream{path, std::ios::binary};
+            return {std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        }
+
+        void WriteBytes(const std::filesystem::path& path, const std::vector<char>& bytes)
+        {
+            std::ofstream stream{path, std::ios::binary};
+            stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+    }
+
+    TEST_CASE("SceneSnapshot round trips a scene", Tags)
+    {
+        TemporaryFile file{"SceneSnapshot_RoundTrip.bin"};
+        std::vector<Sphere> spheres = RandomSpheres(7, 500);
+        SphereSoA soa{spheres};
+        Bvh bvh{spheres};
+        std::vector<Instance> instances = {{0, Transform::Translation({1.0f, 2.0f, 3.0f})},
+                                           {0, Transform::Scaling({2.0f, 1.0f, 1.0f})}};
+        WriteSnapshot(file.path, soa, bvh, instances);
+
+        auto snapshot = SceneSnapshot::Open(file.path);
+        REQUIRE(snapshot.has_value());
+        REQUIRE(snapshot->Size() % SceneSnapshot::SectionAlignment == 0);
+
+        SphereSoAView mappedSpheres = snapshot->Spheres();
+        REQUIRE(mappedSpheres.Size() == spheres.size());
+        REQUIRE(mappedSpheres.PaddedSize() % SphereSoA::Width == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(mappedSpheres.CenterX()) % SceneSnapshot::SectionAlignment == 0);
+
+        BvhView mappedBvh = snapshot->Hierarchy();
+        REQUIRE(mappedBvh.Nodes().size() == bvh.Nodes().size());
+        REQUIRE(mappedBvh.Spheres().size() == spheres.size());
+
+        REQUIRE(snapshot->Instances().size() == instances.size());
+        Vector3 point{0.5f, -1.0f, 2.0f};
+        REQUIRE(snapshot->Instances()[1].transform.TransformPoint(point) ==
+                instances[1].transform.TransformPoint(point));
+
+        std::mt19937 rng{11};
+        std::uniform_real_distribution<float> unit{-1.0f, 1.0f};
+        for (int r = 0; r < 200; ++r)
+        {
+            Ray ray{{unit(rng) * 25.0f, unit(rng) * 25.0f, unit(rng) * 25.0f},
+                    Vector3{unit(rng), unit(rng), unit(rng)}.Normalized()};
+
+            Hit expected = bvh.ClosestHit(ray);
+            Hit mapped = mappedBvh.ClosestHit(ray);
+            REQUIRE(mapped.hit == expected.hit);
+            REQUIRE(mapped.t == expected.t);
+            REQUIRE(mapped.primitive == expected.primitive);
+            REQUIRE(mappedBvh.Occluded(ray, 10.0f) == bvh.Occluded(ray, 10.0f));
+
+            Hit expectedSoA = soa.NearestHit(ray);
+            Hit mappedSoA = mappedSpheres.NearestHit(ray);
+            REQUIRE(mappedSoA.hit == expectedSoA.hit);
+            REQUIRE(mappedSoA.primitive == expectedSoA.primitive);
+        }
+    }
+
+    TEST_CASE("SceneSnapshot round trips an empty scene", Tags)
+    {
+        TemporaryFile file{"SceneSnapshot_Empty.bin"};
+        WriteSnapshot(file.path, SphereSoA{}, Bvh{std::span<const Sphere>{}}, {});
+
+        auto snapshot = SceneSnapshot::Open(file.path);
+        REQUIRE(snapshot.has_value());
+        REQUIRE(snapshot->Spheres().Size() == 0);
+        REQUIRE(snapshot->Hierarchy().Nodes().empty());
+        REQUIRE_FALSE(snapshot->Hierarchy().ClosestHit(Ray{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}).hit);
+    }
+
+    TEST_CASE("SceneSnapshot rejects invalid files", Tags)
+    {
+        TemporaryFile file{"SceneSnapshot_Invalid.bin"};
+        std::vector<Sphere> spheres = RandomSpheres(7, 20);
+        WriteSnapshot(file.path, SphereSoA{spheres}, Bvh{spheres}, {});
+        const std::vector<char> valid = ReadBytes(file.path);
+
+        SECTION("Missing file")
+        {
+            auto snapshot = SceneSnapshot::Open(file.path.string() + ".missing");
+            REQUIRE(snapshot.error() == SnapshotError::CannotOpen);
+        }
+
+        SECTION("Not a snapshot")
+        {
+            WriteBytes(file.path, std::vector<char>(valid.size(), 'x'));
+            REQUIRE(SceneSnapshot::Open(file.path).error() == SnapshotError::NotASnapshot);
+
+            WriteBytes(file.path, {'R', 'T'});
+            REQUIRE(SceneSnapshot::Open(file.path).error() == SnapshotError::NotASnapshot);
+        }
+
+        SECTION("Other version")
+        {
+            std::vector<char> bytes = valid;
+            // The version directly follows the eight byte magic.
+            ++bytes[8];
+            WriteBytes(file.path, bytes);
+            REQUIRE(SceneSnapshot::Open(file.path).error() == SnapshotError::UnsupportedVersion);
+        }
+
+        SECTION("Truncated")
+        {
+            WriteBytes(file.path, {valid.begin(), valid.end() - SceneSnapshot::SectionAlignment});
+            REQUIRE(SceneSnapshot::Open(file.path).error() == SnapshotError::Corrupt);
+        }
+    }
+
+    TEST_CASE("SceneSnapshot rejects hierarchies that traversal cannot follow safely", Tags)
+    {
+        TemporaryFile file{"SceneSnapshot_Hierarchy.bin"};
+        std::vector<Sphere> spheres = RandomSpheres(7, 4);
+        SphereSoA soa{spheres};
+        std::vector<std::uint32_t> primitiveIndices = {0, 1, 2, 3};
+        std::vector<Instance> instances;
+
+        auto leaf = [](std::uint32_t offset, std::uint16_t count) {
+            return BvhNode{{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}, offset, count, 0};
+        };
+        auto interior = [](std::uint32_t secondChild) {
+            return BvhNode{{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}, secondChild, 0, 0};
+        };
+        auto open = [&](const std::vector<BvhNode>& nodes) {
+            {
+                std::ofstream stream{file.path, std::ios::binary};
+                SceneSnapshot::Write(stream, soa.View(), BvhView{nodes, primitiveIndices, spheres}, instances);
+            }
+            return SceneSnapshot::Open(file.path);
+        };
+
+        REQUIRE(open({interior(2), leaf(0, 2), leaf(2, 2)}).has_value());
+
+        SECTION("Leaf past the spheres")
+        {
+            REQUIRE(open({interior(2), leaf(0, 2), leaf(2, 3)}).error() == SnapshotError::Corrupt);
+        }
+
+        SECTION("Child before its parent")
+        {
+            REQUIRE(open({leaf(0, 4), interior(0)}).error() == SnapshotError::Corrupt);
+            REQUIRE(open({interior(2), leaf(0, 4)}).error() == SnapshotError::Corrupt);
+        }
+
+        SECTION("Split axis out of range")
+        {
+            std::vector<BvhNode> nodes = {interior(2), leaf(0, 2), leaf(2, 2)};
+            nodes[0].axis = 3;
+            REQUIRE(open(nodes).error() == SnapshotError::Corrupt);
+        }
+
+        SECTION("Deeper than the traversal stack")
+        {
+            // A chain of interior nodes whose second children all share the last leaf.
+            auto chain = [&](int depth) {
+                std::vector<BvhNode> nodes;
+                for (int i = 0; i < depth; ++i)
+                {
+                    nodes.push_back(interior(static_cast<std::uint32_t>(depth)));
+                }
+                nodes.push_back(leaf(0, 4));
+                return nodes;
+            };
+            REQUIRE(open(chain(BvhView::MaxDepth)).has_value());
+            REQUIRE(open(chain(BvhView::MaxDepth + 1)).error() == SnapshotError::Corrupt);
+        }
+
+        SECTION("Primitive index out of range")
+        {
+            primitiveIndices[1] = 4;
+            REQUIRE(open({interior(2), leaf(0, 2), leaf(2, 2)}).error() == SnapshotError::Corrupt);
+        }
+
+        SECTION("Instance of a missing geometry")
+        {
+            instances = {{0, Transform{}}, {1, Transform{}}};
+            REQUIRE(open({interior(2), leaf(0, 2), leaf(2, 2)}).error() == SnapshotError::Corrupt);
+        }
+    }
+
+    TEST_CASE("SceneSnapshot moves keep the mapping alive", Tags)
+    {
+        TemporaryFile file{"SceneSnapshot_Move.bin"};
+        std::vector<Sphere> spheres = RandomSpheres(7, 10);
+        WriteSnapshot(file.path, SphereSoA{spheres}, Bvh{spheres}, {});
+
+        SceneSnapshot snapshot = std::move(SceneSnapshot::Open(file.path).value());
+        SceneSnapshot moved = std::move(snapshot);
+        REQUIRE(snapshot.Spheres().Size() == 0);
+        REQUIRE(moved.Spheres().Size() == spheres.size());
+        REQUIRE(moved.Spheres()[3].radius == spheres[3].radius);
+    }
+}
@@ -0,0 +1,205 @@
+#include "RayTracer/Shading.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[Shading]";
+
+    namespace
+    {
+        struct Batch
+        {
+            std::vector<float> positionX;
+            std::vector<float> positionY;
+            std::vector<float> positionZ;
+            std::vector<float> normalX;
+            std::vector<float> normalY;
+            std::vector<float> normalZ;
+            std::vector<float> viewX;
+            std::vector<float> viewY;
+            std::vector<float> viewZ;
+            std::vector<std::uint32_t> material;
+
+            void Add(const Vector3& position, const Vector3& normal, const Vector3& view, std::uint32_t materialId)
+            {
+                positionX.push_back(position.x);
+                positionY.push_back(position.y);
+                positionZ.push_back(position.z);
+                normalX.push_back(normal.x);
+                normalY.push_back(normal.y);
+                normalZ.push_back(normal.z);
+                viewX.push_back(view.x);
+                viewY.push_back(view.y);
+                viewZ.push_back(view.z);
+                material.push_back(materialId);
+            }
+
+            SurfaceBatch View() const
+            {
+                return {{positionX, positionY, positionZ},
+                        {normalX, normalY, normalZ},
+                        {viewX, viewY, viewZ},
+                        material};
+            }
+        };
+
+        struct Samples
+        {
+            std::vector<float> toLightX;
+            std::vector<float> toLightY;
+            std::vector<float> toLightZ;
+            std::vector<float> distance;
+            std::vector<float> r;
+            std::vector<float> g;
+            std::vector<float> b;
+
+            explicit Samples(std::size_t size)
+                : toLightX(size)
+                , toLightY(size)
+                , toLightZ(size)
+                , distance(size)
+                , r(size)
+                , g(size)
+                , b(size)
+            {
+            }
+
+            LightSamples View()
+            {
+                return {{toLightX, toLightY, toLightZ}, distance, r, g, b};
+            }
+        };
+
+        void RequireClose(float actual, float expected)
+        {
+            REQUIRE_THAT(actual,
+                         Catch::Matchers::WithinAbs(expected, 1e-5f) || Catch::Matchers::WithinRel(expected, 1e-4f));
+        }
+    }
+
+    TEST_CASE("Lambert materials reflect albedo over pi", Tags)
+    {
+        Material material = Material::Lambert({0.5f, 0.25f, 1.0f});
+        const Vector3 normal{0.0f, 1.0f, 0.0f};
+        const Vector3 view{0.0f, 1.0f, 0.0f};
+        const Vector3 toLight = Vector3{1.0f, 1.0f, 0.0f}.Normalized();
+
+        Color reflected = material.Reflect(normal, view, toLight);
+        const float scale = std::numbers::inv_pi_v<float> * std::sqrt(0.5f);
+        REQUIRE_THAT(reflected.r, Catch::Matchers::WithinRel(0.5f * scale, 1e-6f));
+        REQUIRE_THAT(reflected.g, Catch::Matchers::WithinRel(0.25f * scale, 1e-6f));
+        REQUIRE_THAT(reflected.b, Catch::Matchers::WithinRel(1.0f * scale, 1e-6f));
+
+        REQUIRE(material.Reflect(normal, view, {0.0f, -1.0f, 0.0f}) == Color{0.0f, 0.0f, 0.0f});
+    }
+
+    TEST_CASE("Blinn-Phong highlights peak at the mirror direction", Tags)
+    {
+        Material material = Material::BlinnPhong({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, 32.0f);
+        const Vector3 normal{0.0f, 1.0f, 0.0f};
+        const Vector3 toLight = Vector3{1.0f, 1.0f, 0.0f}.Normalized();
+        const float cosine = std::sqrt(0.5f);
+
+        Color mirror = material.Reflect(normal, Vector3{-1.0f, 1.0f, 0.0f}.Normalized(), toLight);
+        REQUIRE_THAT(mirror.r, Catch::Matchers::WithinRel(Material::SpecularNormalization(32.0f) * cosine, 1e-5f));
+
+        Color offMirror = material.Reflect(normal, Vector3{-1.0f, 2.0f, 0.5f}.Normalized(), toLight);
+        REQUIRE(offMirror.r > 0.0f);
+        REQUIRE(offMirror.r < 0.5f * mirror.r);
+    }
+
+    TEST_CASE("SampleLight applies the inverse square falloff of point lights", Tags)
+    {
+        std::vector<Material> materials = {Material::Lambert({1.0f, 1.0f, 1.0f})};
+        Batch batch;
+        for (int i = 0; i < 11; ++i)
+        {
+            batch.Add({static_cast<float>(i), 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, 0);
+        }
+        Samples samples{11};
+        const Light light = Light::Point({0.0f, 2.0f, 0.0f}, {4.0f, 4.0f, 4.0f});
+        SampleLight(batch.View(), materials, light, samples.View());
+
+        for (int i = 0; i < 11; ++i)
+        {
+            float x = static_cast<float>(i);
+            float squaredDistance = x * x + 4.0f;
+            float distance = std::sqrt(squaredDistance);
+            RequireClose(samples.distance[i], distance);
+            RequireClose(samples.toLightX[i], -x / distance);
+            RequireClose(samples.toLightY[i], 2.0f / distance);
+            RequireClose(samples.r[i], std::numbers::inv_pi_v<float> * (2.0f / distance) * 4.0f / squaredDistance);
+        }
+    }
+
+    TEST_CASE("SampleLight matches Material::Reflect for mixed batches", Tags)
+    {
+        std::vector<Material> materials = {Material::Lambert({0.8f, 0.8f, 0.8f}),
+                                           Material::BlinnPhong({0.2f, 0.3f, 0.4f}, {0.6f, 0.5f, 0.4f}, 8.0f),
+                                           Material::BlinnPhong({0.5f, 0.1f, 0.1f}, {0.9f, 0.9f, 0.9f}, 200.0f)};
+        std::mt19937 generator{3};
+        std::normal_distribution<float> component{0.0f, 1.0f};
+        std::uniform_int_distribution<std::uint32_t> materialId{0, 2};
+        auto randomDirection = [&]() {
+            return Vector3{component(generator), component(generator), component(generator)}.Normalized();
+        };
+
+        // Not a multiple of eight, so the scalar tail runs after the vector loop.
+        constexpr std::size_t Count = 101;
+        Batch batch;
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            Vector3 normal = randomDirection();
+            Vector3 view = randomDirection();
+            if (view.Dot(normal) < 0.0f)
+            {
+                view = -view;
+            }
+            batch.Add(randomDirection() * 3.0f, normal, view, materialId(generator));
+        }
+
+        for (const Light& light : {Light::Point({1.0f, 5.0f, -2.0f}, {30.0f, 20.0f, 10.0f}),
+                                   Light::Directional({0.3f, 1.0f, -0.2f}, {1.0f, 0.9f, 0.8f})})
+        {
+            Samples samples{Count};
+            SampleLight(batch.View(), materials, light, samples.View());
+            for (std::size_t i = 0; i < Count; ++i)
+            {
+                Vector3 position{batch.positionX[i], batch.positionY[i], batch.positionZ[i]};
+                Vector3 toLight = light.vector;
+                Color irradiance = light.color;
+                if (light.type == LightType::Point)
+                {
+                    Vector3 offset = light.vector - position;
+                    toLight = offset.Normalized();
+                    irradiance = irradiance / offset.Dot(offset);
+                    RequireClose(samples.distance[i], offset.Length());
+                }
+                else
+                {
+                    REQUIRE(samples.distance[i] == std::numeric_limits<float>::infinity());
+                }
+
+                const Material& material = materials[batch.material[i]];
+                Color expected = material.Reflect({batch.normalX[i], batch.normalY[i], batch.normalZ[i]},
+                                                  {batch.viewX[i], batch.viewY[i], batch.viewZ[i]}, toLight) *
+                                 irradiance;
+                RequireClose(samples.toLightX[i], toLight.x);
+                RequireClose(samples.toLightY[i], toLight.y);
+                RequireClose(samples.toLightZ[i], toLight.z);
+                RequireClose(samples.r[i], expected.r);
+                RequireClose(samples.g[i], expected.g);
+                RequireClose(samples.b[i], expected.b);
+            }
+        }
+    }
+}
@@ -2,6 +2,8 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cmath>
+
 namespace RayTracer::Tests
 {
     constexpr const char* Tags = "[Sphere]";
@@ -52,4 +54,97 @@ namespace RayTracer::Tests
 
         REQUIRE(normal == Vector3{1.0f, 0.0f, 0.0f});
     }
+
+    TEST_CASE("Sphere packet intersection matches single ray intersection", Tags)
+    {
+        Sphere sphere{{0.0f, 0.0f, 0.0f}, 1.0f};
+        RayPacket8 packet;
+        for (int lane = 0; lane < RayPacket8::Size; ++lane)
+        {
+            float offset = static_cast<float>(lane) * 0.5f - 1.5f;
+            packet.Set(lane, Ray{{offset, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}});
+        }
+        packet.Set(7, Ray{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}});
+
+        Sphere::PacketIntersection packetInter = sphere.Intersect(packet);
+
+        for (int lane = 0; lane < RayPacket8::Size; ++lane)
+        {
+            Sphere::RayIntersection inter = sphere.Intersect(packet.Get(lane));
+            REQUIRE(packetInter.Hit(lane) == inter.hit);
+            REQUIRE(std::fabsf(packetInter.t1[lane] - inter.t1) < 1e-5f);
+            REQUIRE(std::fabsf(packetInter.t2[lane] - inter.t2) < 1e-5f);
+        }
+        REQUIRE_FALSE(packetInter.Hit(0));
+        REQUIRE(packetInter.Hit(3));
+        REQUIRE(packetInter.t1[7] == 1.0f);
+    }
+
+    TEST_CASE("Sphere occlusion respects the interval", Tags)
+    {
+        Sphere sphere{{0.0f, 0.0f, 0.0f}, 1.0f};
+        Ray ray{{0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}};
+
+        REQUIRE(sphere.Occluded(ray, 10.0f));
+        REQUIRE(sphere.Occluded(ray, 4.0f));
+        REQUIRE_FALSE(sphere.Occluded(ray, 3.9f));
+        // Starting inside the sphere only the far root counts.
+        REQUIRE(sphere.Occluded(ray, 5.0f, 6.0f));
+        REQUIRE_FALSE(sphere.Occluded(ray, 6.1f, 10.0f));
+        REQUIRE_FALSE(sphere.Occluded(Ray{{0.0f, 2.0f, -5.0f}, {0.0f, 0.0f, 1.0f}}, 10.0f));
+    }
+
+    TEST_CASE("Sphere occlusion agrees with intersection", Tags)
+    {
+        Sphere sphere{{0.5f, -0.25f, 2.0f}, 1.5f};
+        for (int i = 0; i < 64; ++i)
+        {
+            float angle = static_cast<float>(i) * 0.1f;
+            Ray ray{{0.0f, 0.0f, -3.0f}, {std::sinf(angle), 0.1f, std::cosf(angle)}};
+            Sphere::RayIntersection inter = sphere.Intersect(ray);
+
+            REQUIRE(sphere.Occluded(ray, 100.0f) == inter.hit);
+            if (inter.hit)
+            {
+                REQUIRE_FALSE(sphere.Occluded(ray, inter.t1 * 0.99f));
+            }
+        }
+    }
+
+    TEST_CASE("Sphere interval intersection returns a complete hit", Tags)
+    {
+        Sphere sphere{{0.0f, 0.0f, 0.0f}, 2.0f};
+        Ray ray{{0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}};
+        Hit hit = sphere.Intersect(ray, 0.0f, 100.0f);
+
+        REQUIRE(hit.hit);
+        REQUIRE(hit.t == 3.0f);
+        REQUIRE(hit.position == Vector3{0.0f, 0.0f, -2.0f});
+        REQUIRE(hit.normal == Vector3{0.0f, 0.0f, -1.0f});
+        REQUIRE(hit.frontFace);
+    }
+
+    TEST_CASE("Sphere interval intersection from inside faces the normal inwards", Tags)
+    {
+        Sphere sphere{{0.0f, 0.0f, 0.0f}, 2.0f};
+        Ray ray{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}};
+        Hit hit = sphere.Intersect(ray, 0.0f, 100.0f);
+
+        REQUIRE(hit.hit);
+        REQUIRE(hit.t == 2.0f);
+        REQUIRE(hit.normal == Vector3{-1.0f, 0.0f, 0.0f});
+        REQUIRE_FALSE(hit.frontFace);
+    }
+
+    TEST_CASE("Sphere interval intersection rejects roots outside the interval", Tags)
+    {
+        Sphere sphere{{0.0f, 0.0f, 0.0f}, 1.0f};
+        Ray ray{{0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}};
+        float t = 0.0f;
+
+        REQUIRE_FALSE(sphere.Intersect(ray, 0.0f, 3.5f, t));
+        REQUIRE(sphere.Intersect(ray, 4.5f, 10.0f, t));
+        REQUIRE(t == 6.0f);
+        REQUIRE_FALSE(sphere.Intersect(ray, 6.5f, 10.0f, t));
+    }
 }
@@ -0,0 +1,159 @@
+#include "RayTracer/Accelerator.hpp"
+#include "RayTracer/SphereGrid.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+    constexpr const char* Tags = "[SphereGrid]";
+
+    static_assert(Accelerator<SphereGrid>);
+
+    namespace
+    {
+        void RequireBruteForceHits(const std::vector<Sphere>& spheres, const SphereGrid& grid, std::mt19937& rng)
+        {
+            std::uniform_real_distribution<float> position{-25.0f, 25.0f};
+            for (int i = 0; i < 300; ++i)
+            {
+                Ray ray{{position(rng), position(rng), position(rng)}, {position(rng), position(rng), position(rng)}};
+
+                Hit expected;
+                for (std::size_t s = 0; s < spheres.size(); ++s)
+                {
+                    Hit candidate = spheres[s].Intersect(ray, 0.0f, expected.hit ? expected.t : Infinity);
+                    if (candidate.hit && (!expected.hit || candidate.t < expected.t))
+                    {
+                        expected = candidate;
+                        expected.primitive = static_cast<std::uint32_t>(s);
+                    }
+                }
+
+                Hit hit = grid.ClosestHit(ray);
+                REQUIRE(hit.hit == expected.hit);
+                if (expected.hit)
+                {
+                    REQUIRE(hit.primitive == expected.primitive);
+                    REQUIRE(hit.t == expected.t);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("SphereGrid over no spheres never hits", Tags)
+    {
+        SphereGrid grid{std::span<const Sphere>{}};
+
+        REQUIRE_FALSE(grid.ClosestHit(Ray{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}).hit);
+    }
+
+    TEST_CASE("SphereGrid resolution follows density", Tags)
+    {
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 1000; ++i)
+        {
+            Vector3 center{static_cast<float>(i % 10), static_cast<float>(i / 10 % 10), static_cast<float>(i / 100)};
+            spheres.push_back({center, 0.4f});
+        }
+        SphereGrid grid{spheres, {.density = 1.0f}};
+
+        const SphereGrid::Level& top = grid.TopLevel();
+        REQUIRE(top.resolution[0] == top.resolution[1]);
+        REQUIRE(top.resolution[1] == top.resolution[2]);
+        REQUIRE(top.resolution[0] >= 9);
+        REQUIRE(top.resolution[0] <= 10);
+    }
+
+    TEST_CASE("SphereGrid closest hit matches brute force", Tags)
+    {
+        std::mt19937 rng{5};
+        std::uniform_real_distribution<float> position{-20.0f, 20.0f};
+        std::uniform_real_distribution<float> size{0.1f, 1.5f};
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 1000; ++i)
+        {
+            spheres.push_back({{position(rng), position(rng), position(rng)}, size(rng)});
+        }
+
+        SphereGrid grid{spheres, {.threadCount = 4}};
+        RequireBruteForceHits(spheres, grid, rng);
+    }
+
+    TEST_CASE("Two-level SphereGrid subdivides crowded cells", Tags)
+    {
+        std::mt19937 rng{17};
+        std::uniform_real_distribution<float> sparse{-20.0f, 20.0f};
+        std::uniform_real_distribution<float> cluster{-1.0f, 1.0f};
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 200; ++i)
+        {
+            spheres.push_back({{sparse(rng), sparse(rng), sparse(rng)}, 0.5f});
+        }
+        for (int i = 0; i < 800; ++i)
+        {
+            spheres.push_back({{cluster(rng), cluster(rng), cluster(rng)}, 0.05f});
+        }
+
+        SphereGrid grid{spheres, {.density = 0.5f, .subdivideThreshold = 16, .threadCount = 4}};
+        REQUIRE(grid.SubgridCount() > 0);
+        RequireBruteForceHits(spheres, grid, rng);
+    }
+
+    TEST_CASE("SphereGrid only reports hits inside the ray interval", Tags)
+    {
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 10; ++i)
+        {
+            spheres.push_back({{static_cast<float>(i), 0.0f, 0.0f}, 0.25f});
+        }
+        SphereGrid accelerator{spheres};
+        Ray ray{{-5.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, UnitDirection};
+
+        // Sphere 2 spans t = 6.75 to 7.25, so starting at t = 7 hits its far side.
+        Hit hit = accelerator.ClosestHit(TraversalRay{ray, 7.0f});
+        REQUIRE(hit.hit);
+        REQUIRE(hit.primitive == 2);
+        REQUIRE(hit.t == 7.25f);
+
+        REQUIRE_FALSE(accelerator.ClosestHit(TraversalRay{ray, 7.3f, 7.7f}).hit);
+        REQUIRE(accelerator.ClosestHit(TraversalRay{ray, 0.0f, 5.0f}).primitive == 0);
+    }
+
+    TEST_CASE("SphereGrid occlusion matches brute force", Tags)
+    {
+        std::mt19937 rng{7};
+        std::uniform_real_distribution<float> position{-20.0f, 20.0f};
+        std::uniform_real_distribution<float> size{0.1f, 1.5f};
+        std::uniform_real_distribution<float> distance{0.0f, 30.0f};
+
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 500; ++i)
+        {
+            spheres.push_back({{position(rng), position(rng), position(rng)}, size(rng)});
+        }
+        SphereGrid accelerator{spheres, {.subdivideThreshold = 4}};
+
+        int occludedCount = 0;
+        for (int i = 0; i < 300; ++i)
+        {
+            Ray ray{{position(rng), position(rng), position(rng)}, {position(rng), position(rng), position(rng)}};
+            float tMax = distance(rng);
+
+            bool expected = false;
+            for (const Sphere& sphere : spheres)
+            {
+                expected = expected || sphere.Occluded(ray, tMax);
+            }
+
+            REQUIRE(accelerator.Occluded(ray, tMax) == expected);
+            occludedCount += expected ? 1 : 0;
+        }
+        REQUIRE(occludedCount > 0);
+        REQUIRE(occludedCount < 300);
+    }
+}
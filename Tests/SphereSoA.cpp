@@ -0,0 +1,111 @@
+#include "RayTracer/SphereSoA.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+    constexpr const char* Tags = "[SphereSoA]";
+
+    TEST_CASE("SphereSoA stores spheres as separate arrays", Tags)
+    {
+        SphereSoA soa;
+        soa.Add({{1.0f, 2.0f, 3.0f}, 0.5f});
+        soa.Add({{4.0f, 5.0f, 6.0f}, 1.5f});
+
+        REQUIRE(soa.Size() == 2);
+        REQUIRE(soa.CenterX()[1] == 4.0f);
+        REQUIRE(soa.CenterY()[1] == 5.0f);
+        REQUIRE(soa.CenterZ()[1] == 6.0f);
+        REQUIRE(soa.Radius()[0] == 0.5f);
+        REQUIRE(soa[0].center == Vector3{1.0f, 2.0f, 3.0f});
+        REQUIRE(reinterpret_cast<std::uintptr_t>(soa.CenterX()) % 32 == 0);
+    }
+
+    TEST_CASE("SphereSoA resize pads with spheres that are never hit", Tags)
+    {
+        SphereSoA soa;
+        soa.Resize(11);
+        soa.Set(10, {{0.0f, 0.0f, 5.0f}, 1.0f});
+        REQUIRE(soa.Size() == 11);
+        REQUIRE(soa[3].radius == 1.0f);
+        REQUIRE(soa[10].center == Vector3{0.0f, 0.0f, 5.0f});
+
+        soa.Resize(3);
+        REQUIRE(soa.Size() == 3);
+        REQUIRE(soa.View().PaddedSize() == SphereSoA::Width);
+        REQUIRE(std::isnan(soa.CenterX()[3]));
+
+        Ray ray{{0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}};
+        Hit hit = soa.NearestHit(ray);
+        REQUIRE(hit.hit);
+        REQUIRE(hit.primitive == 0);
+    }
+
+    TEST_CASE("SphereSoA nearest hit on empty collection", Tags)
+    {
+        SphereSoA soa;
+        Hit hit = soa.NearestHit(Ray{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}});
+
+        REQUIRE_FALSE(hit.hit);
+    }
+
+    TEST_CASE("SphereSoA nearest hit picks the closest sphere", Tags)
+    {
+        std::vector<Sphere> spheres{
+            {{0.0f, 0.0f, 10.0f}, 1.0f},
+            {{0.0f, 0.0f, 5.0f}, 1.0f},
+            {{0.0f, 3.0f, 2.0f}, 1.0f},
+        };
+        SphereSoA soa{spheres};
+        Hit hit = soa.NearestHit(Ray{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}});
+
+        REQUIRE(hit.hit);
+        REQUIRE(hit.primitive == 1);
+        REQUIRE(hit.t == 4.0f);
+    }
+
+    TEST_CASE("SphereSoA nearest hit matches brute force", Tags)
+    {
+        std::mt19937 rng{1234};
+        std::uniform_real_distribution<float> position{-10.0f, 10.0f};
+        std::uniform_real_distribution<float> size{0.1f, 1.0f};
+
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 203; ++i)
+        {
+            spheres.push_back({{position(rng), position(rng), position(rng)}, size(rng)});
+        }
+        SphereSoA soa{spheres};
+
+        for (int i = 0; i < 100; ++i)
+        {
+            Ray ray{{position(rng), position(rng), position(rng)}, {position(rng), position(rng), position(rng)}};
+
+            Hit expected;
+            for (std::size_t s = 0; s < spheres.size(); ++s)
+            {
+                Hit candidate = spheres[s].Intersect(ray, 0.0f, expected.hit ? expected.t : Infinity);
+                if (candidate.hit && (!expected.hit || candidate.t < expected.t))
+                {
+                    expected = candidate;
+                    expected.primitive = static_cast<std::uint32_t>(s);
+                }
+            }
+
+            Hit hit = soa.NearestHit(ray);
+            REQUIRE(hit.hit == expected.hit);
+            if (expected.hit)
+            {
+                REQUIRE(hit.primitive == expected.primitive);
+                REQUIRE(std::fabsf(hit.t - expected.t) < 1e-3f);
+            }
+        }
+    }
+}
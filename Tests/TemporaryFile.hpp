@@ -0,0 +1,27 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+namespace RayTracer::Tests
+{
+    /**
+     * A file in the temporary directory that is removed again at the end of the test.
+     */
+    struct TemporaryFile
+    {
+        std::filesystem::path path;
+
+        explicit TemporaryFile(const std::string& name)
+            : path{std::filesystem::temp_directory_path() / ("RayTracer_" + name)}
+        {
+        }
+
+        ~TemporaryFile()
+        {
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        }
+    };
+}
@@ -0,0 +1,168 @@
+#include "RayTracer/TextScene.hpp"
+#include "RayTracer/ThreadPool.hpp"
+
+#include "RandomSpheres.hpp"
+#include "TemporaryFile.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[TextScene]";
+
+    // Coordinates over several orders of magnitude, so the written floats need varying numbers of digits.
+    constexpr SphereRange Range{1000.0f, 0.01f, 10.0f};
+
+    TEST_CASE("TextScene parses spheres and instances", Tags)
+    {
+        ThreadPool pool{2};
+        auto scene = TextScene::Parse("# a comment\n"
+                                      "sphere 1 2 3 0.5\r\n"
+                                      "\n"
+                                      "   sphere -1.5e2 0 4 2 # trailing comment\n"
+                                      "instance 7 2 0 0 10 0 2 0 0 0 0 2 -3\n"
+                                      "sphere 0 0 0 1",
+                                      pool);
+
+        REQUIRE(scene.has_value());
+        REQUIRE(scene->spheres.Size() == 3);
+        REQUIRE(scene->spheres[0].center == Vector3{1.0f, 2.0f, 3.0f});
+        REQUIRE(scene->spheres[0].radius == 0.5f);
+        REQUIRE(scene->spheres[1].center == Vector3{-150.0f, 0.0f, 4.0f});
+        REQUIRE(scene->spheres[2].radius == 1.0f);
+
+        REQUIRE(scene->instances.size() == 1);
+        REQUIRE(scene->instances[0].geometry == 7);
+        REQUIRE(scene->instances[0].transform.TransformPoint({1.0f, 1.0f, 1.0f}) == Vector3{12.0f, 2.0f, -1.0f});
+    }
+
+    TEST_CASE("TextScene parses empty text", Tags)
+    {
+        ThreadPool pool{2};
+        auto scene = TextScene::Parse("", pool);
+
+        REQUIRE(scene.has_value());
+        REQUIRE(scene->spheres.Size() == 0);
+        REQUIRE(scene->instances.empty());
+    }
+
+    TEST_CASE("TextScene reports the line of an error", Tags)
+    {
+        ThreadPool pool{2};
+        auto errorLine = [&](std::string_view text) {
+            auto scene = TextScene::Parse(text, pool);
+            REQUIRE_FALSE(scene.has_value());
+            return scene.error().line;
+        };
+
+        REQUIRE(errorLine("sphere 0 0 0 1\ncube 1 2 3\n") == 2);
+        REQUIRE(errorLine("sphere 0 0 0\n") == 1);
+        REQUIRE(errorLine("\n\nsphere 0 0 0 1 5\n") == 3);
+        REQUIRE(errorLine("sphere 0 0 1.5.2 1\n") == 1);
+        REQUIRE(errorLine("instance -1 1 0 0 0 0 1 0 0 0 0 1 0\n") == 1);
+        REQUIRE(errorLine("instance 0 1 0 0 0 0 1 0 0 0 0 1\n") == 1);
+    }
+
+    TEST_CASE("TextScene round trips a large scene across chunks", Tags)
+    {
+        std::vector<Sphere> spheres = RandomSpheres(3, 100000, Range);
+        std::vector<Instance> instances = {{1, Transform::RotationY(0.3f) * Transform::Translation({1.0f, 2.0f, 3.0f})},
+                                           {2, Transform::Scaling({0.5f, 2.0f, 1.0f})}};
+        std::ostringstream stream;
+        TextScene::Write(stream, SphereSoA{spheres}.View(), instances);
+        std::string text = stream.str();
+
+        ThreadPool pool{4};
+        auto scene = TextScene::Parse(text, pool);
+        REQUIRE(scene.has_value());
+        REQUIRE(scene->spheres.Size() == spheres.size());
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < spheres.size(); ++i)
+        {
+            mismatches += scene->spheres[i].center == spheres[i].center && scene->spheres[i].radius == spheres[i].radius
+                              ? 0
+                              : 1;
+        }
+        REQUIRE(mismatches == 0);
+        REQUIRE(scene->instances.size() == instances.size());
+        REQUIRE(scene->instances[1].geometry == 2);
+        REQUIRE(scene->instances[0].transform.ToMatrix() == instances[0].transform.ToMatrix());
+
+        // Of several broken lines in different chunks, the first one in the file is reported.
+        std::size_t secondLine = text.find('\n') + 1;
+        text.replace(text.size() - 10, 1, "x");
+        text.replace(secondLine, 6, "sfere ");
+        auto broken = TextScene::Parse(text, pool);
+        REQUIRE_FALSE(broken.has_value());
+        REQUIRE(broken.error().line == 2);
+    }
+
+    TEST_CASE("TextScene parses from inside a pool task", Tags)
+    {
+        std::vector<Sphere> spheres = RandomSpheres(3, 10000, Range);
+        std::ostringstream stream;
+        TextScene::Write(stream, SphereSoA{spheres}.View(), {});
+        const std::string text = stream.str();
+
+        // An asynchronous load runs on the same pool that parses the chunks.
+        ThreadPool pool{2};
+        std::size_t sphereCount = 0;
+        pool.Submit([&](unsigned) {
+            auto scene = TextScene::Parse(text, pool);
+            sphereCount = scene.has_value() ? scene->spheres.Size() : 0;
+        });
+        pool.Wait();
+
+        REQUIRE(sphereCount == spheres.size());
+    }
+
+    TEST_CASE("TextScene loads a file in place", Tags)
+    {
+        TemporaryFile file{"TextScene_Load.txt"};
+        std::vector<Sphere> spheres = RandomSpheres(3, 20000, Range);
+        SphereSoA soa{spheres};
+        std::vector<Instance> instances = {{1, Transform::Translation({1.0f, 2.0f, 3.0f})}};
+        {
+            std::ofstream stream{file.path, std::ios::binary};
+            TextScene::Write(stream, soa.View(), instances);
+        }
+
+        ThreadPool pool{4};
+        auto scene = TextScene::Load(file.path, pool);
+        REQUIRE(scene.has_value());
+        REQUIRE(scene->spheres.Size() == spheres.size());
+        for (std::size_t i = 0; i < spheres.size(); i += 997)
+        {
+            REQUIRE(scene->spheres[i].center == spheres[i].center);
+            REQUIRE(scene->spheres[i].radius == spheres[i].radius);
+        }
+        REQUIRE(scene->instances.size() == 1);
+        REQUIRE(scene->instances[0].geometry == 1);
+    }
+
+    TEST_CASE("TextScene loads an empty file as an empty scene", Tags)
+    {
+        TemporaryFile file{"TextScene_Empty.txt"};
+        std::ofstream{file.path, std::ios::binary}.close();
+
+        ThreadPool pool{1};
+        auto scene = TextScene::Load(file.path, pool);
+        REQUIRE(scene.has_value());
+        REQUIRE(scene->spheres.Size() == 0);
+        REQUIRE(scene->instances.empty());
+    }
+
+    TEST_CASE("TextScene load reports a missing file", Tags)
+    {
+        ThreadPool pool{1};
+        auto scene = TextScene::Load("RayTracer_missing_scene.txt", pool);
+
+        REQUIRE_FALSE(scene.has_value());
+        REQUIRE(scene.error().line == 0);
+    }
+}
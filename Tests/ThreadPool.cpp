@@ -0,0 +1,126 @@
+#include "RayTracer/ThreadPool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[ThreadPool]";
+
+    TEST_CASE("ThreadPool creates the requested number of workers", Tags)
+    {
+        ThreadPool pool{3};
+
+        REQUIRE(pool.ThreadCount() == 3);
+    }
+
+    TEST_CASE("ThreadPool runs every submitted task", Tags)
+    {
+        ThreadPool pool{4};
+        std::atomic<int> sum = 0;
+        for (int i = 1; i <= 100; ++i)
+        {
+            pool.Submit([&sum, i](unsigned) { sum += i; });
+        }
+        pool.Wait();
+
+        REQUIRE(sum == 5050);
+    }
+
+    TEST_CASE("ThreadPool stats count every task", Tags)
+    {
+        ThreadPool pool{4};
+        std::atomic<unsigned> maxWorker = 0;
+        for (int i = 0; i < 64; ++i)
+        {
+            pool.Submit([&maxWorker](unsigned worker) { maxWorker = std::max(maxWorker.load(), worker); });
+        }
+        pool.Wait();
+
+        REQUIRE(maxWorker < 4);
+
+        auto stats = pool.Stats();
+        std::uint64_t tasks = 0;
+        for (const auto& worker : stats)
+        {
+            tasks += worker.tasks;
+        }
+        REQUIRE(tasks == 64);
+
+        pool.ResetStats();
+        REQUIRE(pool.Stats()[0].tasks == 0);
+    }
+
+    TEST_CASE("ThreadPool can be reused after waiting", Tags)
+    {
+        ThreadPool pool{2};
+        std::atomic<int> count = 0;
+        for (int round = 0; round < 3; ++round)
+        {
+            for (int i = 0; i < 10; ++i)
+            {
+                pool.Submit([&count](unsigned) { ++count; });
+            }
+            pool.Wait();
+            REQUIRE(count == (round + 1) * 10);
+        }
+    }
+
+    TEST_CASE("ThreadPool ParallelFor calls the function once per index", Tags)
+    {
+        ThreadPool pool{4};
+        std::vector<std::atomic<int>> calls(1000);
+        pool.ParallelFor(calls.size(), [&](std::size_t i) { ++calls[i]; });
+
+        REQUIRE(std::all_of(calls.begin(), calls.end(), [](const std::atomic<int>& count) { return count == 1; }));
+    }
+
+    TEST_CASE("ThreadPool ParallelFor can be nested inside tasks", Tags)
+    {
+        // Every worker runs an outer task, so the inner loops only finish because their callers take part.
+        ThreadPool pool{2};
+        std::atomic<int> sum = 0;
+        for (int task = 0; task < 4; ++task)
+        {
+            pool.Submit([&](unsigned) { pool.ParallelFor(100, [&](std::size_t i) { sum += static_cast<int>(i); }); });
+        }
+        pool.Wait();
+
+        REQUIRE(sum == 4 * 4950);
+    }
+
+    TEST_CASE("ThreadPool ParallelFor passes the index of the running thread", Tags)
+    {
+        ThreadPool pool{3};
+        REQUIRE(pool.CurrentWorker() == pool.ThreadCount());
+
+        // Every index of one call is either a worker or the calling thread, so at most one call runs per index.
+        std::vector<std::atomic<int>> running(pool.ThreadCount() + 1);
+        std::atomic<bool> overlapped = false;
+        pool.ParallelFor(500, [&](std::size_t, unsigned worker) {
+            if (++running[worker] != 1)
+            {
+                overlapped = true;
+            }
+            --running[worker];
+        });
+        REQUIRE_FALSE(overlapped);
+
+        std::atomic<bool> matches = true;
+        for (int task = 0; task < 6; ++task)
+        {
+            pool.Submit([&](unsigned worker) {
+                if (pool.CurrentWorker() != worker)
+                {
+                    matches = false;
+                }
+            });
+        }
+        pool.Wait();
+        REQUIRE(matches);
+    }
+}
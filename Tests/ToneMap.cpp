@@ -0,0 +1,183 @@
+#include "RayTracer/ToneMap.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[ToneMap]";
+
+    namespace
+    {
+        /**
+         * The byte an exact conversion would produce, without the table.
+         */
+        int ExactByte(const ToneMapper& toneMapper, float value)
+        {
+            return static_cast<int>(std::lround(ToneMapper::LinearToSrgb(toneMapper.ToneMap(value)) * 255.0f));
+        }
+
+        void RequireMatchesExact(const ToneMapper& toneMapper, const std::vector<Color>& colors)
+        {
+            std::vector<std::uint32_t> pixels(colors.size());
+            toneMapper.ConvertRow(colors, pixels);
+            for (std::size_t i = 0; i < colors.size(); ++i)
+            {
+                REQUIRE(std::abs(Rgba8Channel(pixels[i], 0) - ExactByte(toneMapper, colors[i].r)) <= 1);
+                REQUIRE(std::abs(Rgba8Channel(pixels[i], 1) - ExactByte(toneMapper, colors[i].g)) <= 1);
+                REQUIRE(std::abs(Rgba8Channel(pixels[i], 2) - ExactByte(toneMapper, colors[i].b)) <= 1);
+                REQUIRE(Rgba8Channel(pixels[i], 3) == 255);
+            }
+        }
+
+        /**
+         * A ramp over [-0.5, 4) with a different offset per channel. 1003 is not a multiple of eight, so the scalar
+         * tail runs after the vector loop.
+         */
+        std::vector<Color> Ramp()
+        {
+            std::vector<Color> colors;
+            for (int i = 0; i < 1003; ++i)
+            {
+                float t = static_cast<float>(i) / 1003.0f;
+                colors.push_back({4.5f * t - 0.5f, 4.0f * t * t, t * 0.1f});
+            }
+            return colors;
+        }
+    }
+
+    TEST_CASE("PackRgba8 stores red in the lowest byte", Tags)
+    {
+        std::uint32_t pixel = PackRgba8(1, 2, 3, 4);
+
+        REQUIRE(pixel == 0x04030201u);
+        REQUIRE(Rgba8Channel(pixel, 0) == 1);
+        REQUIRE(Rgba8Channel(pixel, 3) == 4);
+    }
+
+    TEST_CASE("Rgba8Image rows start on cache lines", Tags)
+    {
+        Rgba8Image image{13, 7};
+
+        REQUIRE(image.Width() == 13);
+        REQUIRE(image.Height() == 7);
+        REQUIRE(image.Row(3).size() == 13);
+        for (int y = 0; y < image.Height(); ++y)
+        {
+            auto address = reinterpret_cast<std::uintptr_t>(image.Row(y).data());
+            REQUIRE(address % Rgba8Image::CacheLineSize == 0);
+        }
+    }
+
+    TEST_CASE("LinearToSrgb follows the sRGB transfer curve", Tags)
+    {
+        REQUIRE(ToneMapper::LinearToSrgb(0.0f) == 0.0f);
+        REQUIRE_THAT(ToneMapper::LinearToSrgb(1.0f), Catch::Matchers::WithinAbs(1.0f, 1e-6f));
+        REQUIRE_THAT(ToneMapper::LinearToSrgb(0.002f), Catch::Matchers::WithinRel(0.02584f, 1e-4f));
+        REQUIRE_THAT(ToneMapper::LinearToSrgb(0.18f), Catch::Matchers::WithinAbs(0.4614f, 1e-4f));
+    }
+
+    TEST_CASE("ToneMap applies exposure and the operator", Tags)
+    {
+        ToneMapper clamp{{2.0f, ToneMapOperator::Clamp}};
+        REQUIRE(clamp.ToneMap(0.25f) == 0.5f);
+        REQUIRE(clamp.ToneMap(3.0f) == 1.0f);
+        REQUIRE(clamp.ToneMap(-1.0f) == 0.0f);
+
+        ToneMapper reinhard{{1.0f, ToneMapOperator::Reinhard}};
+        REQUIRE(reinhard.ToneMap(1.0f) == 0.5f);
+        REQUIRE(reinhard.ToneMap(std::numeric_limits<float>::infinity()) > 0.999f);
+
+        ToneMapper aces{{1.0f, ToneMapOperator::Aces}};
+        REQUIRE(aces.ToneMap(0.0f) == 0.0f);
+        REQUIRE(aces.ToneMap(0.5f) < aces.ToneMap(1.0f));
+        REQUIRE(aces.ToneMap(100.0f) == 1.0f);
+
+        REQUIRE(aces.ToneMap(std::numeric_limits<float>::quiet_NaN()) == 0.0f);
+    }
+
+    TEST_CASE("ConvertRow matches the exact conversion to within one step", Tags)
+    {
+        const std::vector<Color> colors = Ramp();
+        for (ToneMapOperator toneMap : {ToneMapOperator::Clamp, ToneMapOperator::Reinhard, ToneMapOperator::Aces})
+        {
+            RequireMatchesExact(ToneMapper{{1.0f, toneMap}}, colors);
+            RequireMatchesExact(ToneMapper{{0.3f, toneMap}}, colors);
+        }
+    }
+
+    TEST_CASE("ConvertRow maps non-finite colors to black or white", Tags)
+    {
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        const float infinity = std::numeric_limits<float>::infinity();
+        std::vector<Color> colors(9, {nan, infinity, -infinity});
+        std::vector<std::uint32_t> pixels(colors.size());
+        ToneMapper{{1.0f, ToneMapOperator::Reinhard}}.ConvertRow(colors, pixels);
+
+        for (std::uint32_t pixel : pixels)
+        {
+            REQUIRE(pixel == PackRgba8(0, 255, 0));
+        }
+    }
+
+    TEST_CASE("Convert converts every tile of the framebuffer", Tags)
+    {
+        const std::vector<Color> ramp = Ramp();
+        Framebuffer framebuffer{37, 29};
+        for (int y = 0; y < framebuffer.Height(); ++y)
+        {
+            for (int x = 0; x < framebuffer.Width(); ++x)
+            {
+                framebuffer.At(x, y) = ramp[static_cast<std::size_t>(y * framebuffer.Width() + x) % ramp.size()];
+            }
+        }
+        ThreadPool pool{4};
+        ToneMapper toneMapper{{1.5f, ToneMapOperator::Aces}};
+        Rgba8Image image{framebuffer.Width(), framebuffer.Height()};
+        toneMapper.Convert(pool, framebuffer, image, 8);
+
+        std::vector<std::uint32_t> expected(static_cast<std::size_t>(framebuffer.Width()));
+        for (int y = 0; y < framebuffer.Height(); ++y)
+        {
+            toneMapper.ConvertRow(framebuffer.Row(y), expected);
+            for (int x = 0; x < framebuffer.Width(); ++x)
+            {
+                REQUIRE(image.At(x, y) == expected[x]);
+            }
+        }
+    }
+
+    TEST_CASE("Convert can run inside a pool task", Tags)
+    {
+        Framebuffer framebuffer{300, 200};
+        for (int y = 0; y < framebuffer.Height(); ++y)
+        {
+            for (int x = 0; x < framebuffer.Width(); ++x)
+            {
+                framebuffer.At(x, y) = {static_cast<float>(x) / 300.0f, static_cast<float>(y) / 200.0f, 0.5f};
+            }
+        }
+        // A single worker, so the task converting the image is the only thread that can run the tiles.
+        ThreadPool pool{1};
+        ToneMapper toneMapper;
+        Rgba8Image image{framebuffer.Width(), framebuffer.Height()};
+        pool.Submit([&](unsigned) { toneMapper.Convert(pool, framebuffer, image, 64); });
+        pool.Wait();
+
+        std::vector<std::uint32_t> expected(static_cast<std::size_t>(framebuffer.Width()));
+        for (int y = 0; y < framebuffer.Height(); ++y)
+        {
+            toneMapper.ConvertRow(framebuffer.Row(y), expected);
+            for (int x = 0; x < framebuffer.Width(); ++x)
+            {
+                REQUIRE(image.At(x, y) == expected[x]);
+            }
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#include "RayTracer/Transform.hpp"
+#include "RayTracer/Matrix.hpp"
+#include "RayTracer/Vector4.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[Transform]";
+
+    namespace
+    {
+        Matrix ExampleMatrix()
+        {
+            return Matrix::Scaling({2.0f, 0.5f, 3.0f}) * Matrix::RotationX(0.4f) * Matrix::RotationY(-1.2f) *
+                   Matrix::Shear(0.5f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f) * Matrix::Translation({10.0f, -4.0f, 7.0f});
+        }
+
+        Transform ExampleTransform()
+        {
+            return Transform::Scaling({2.0f, 0.5f, 3.0f}) * Transform::RotationX(0.4f) *
+                   Transform::RotationY(-1.2f) * Transform::Shear(0.5f, 0.0f, 0.0f, 0.25f, 0.0f, 0.0f) *
+                   Transform::Translation({10.0f, -4.0f, 7.0f});
+        }
+
+        void RequireNear(const Vector3& actual, const Vector3& expected)
+        {
+            REQUIRE_THAT(actual.x, Catch::Matchers::WithinAbs(expected.x, 1e-4f));
+            REQUIRE_THAT(actual.y, Catch::Matchers::WithinAbs(expected.y, 1e-4f));
+            REQUIRE_THAT(actual.z, Catch::Matchers::WithinAbs(expected.z, 1e-4f));
+        }
+    }
+
+    TEST_CASE("Transform default is the identity", Tags)
+    {
+        Transform identity;
+        Vector3 point{1.0f, -2.0f, 3.0f};
+
+        REQUIRE(identity.TransformPoint(point) == point);
+        REQUIRE(identity.TransformVector(point) == point);
+        REQUIRE(identity.TransformNormal(point) == point);
+        REQUIRE(identity.ToMatrix() == Matrix::Identity());
+    }
+
+    TEST_CASE("Transform matches the matrix it was built from", Tags)
+    {
+        Matrix matrix = ExampleMatrix();
+        Transform transform{matrix};
+        Vector3 v{0.5f, -1.5f, 2.0f};
+
+        Vector4 point = matrix * Vector4{v, 1.0f};
+        Vector4 vector = matrix * Vector4{v, 0.0f};
+        RequireNear(transform.TransformPoint(v), {point.x, point.y, point.z});
+        RequireNear(transform.TransformVector(v), {vector.x, vector.y, vector.z});
+        REQUIRE(transform.ToMatrix() == matrix);
+    }
+
+    TEST_CASE("Transform composition matches matrix composition", Tags)
+    {
+        Transform composed = ExampleTransform();
+        Transform fromMatrix{ExampleMatrix()};
+        Vector3 v{0.5f, -1.5f, 2.0f};
+
+        RequireNear(composed.TransformPoint(v), fromMatrix.TransformPoint(v));
+        RequireNear(composed.Inverse().TransformPoint(v), fromMatrix.Inverse().TransformPoint(v));
+        RequireNear(composed.TransformNormal(v), fromMatrix.TransformNormal(v));
+    }
+
+    TEST_CASE("Transform inverse undoes the transform", Tags)
+    {
+        Transform transform = ExampleTransform();
+        Transform inverse = transform.Inverse();
+        Vector3 v{0.5f, -1.5f, 2.0f};
+
+        RequireNear(inverse.TransformPoint(transform.TransformPoint(v)), v);
+        RequireNear(transform.TransformVector(inverse.TransformVector(v)), v);
+
+        Matrix expected = ExampleMatrix().Inverse();
+        Matrix actual = inverse.ToMatrix();
+        for (int i = 0; i < 16; ++i)
+        {
+            REQUIRE_THAT(actual.elements[i], Catch::Matchers::WithinAbs(expected.elements[i], 1e-4f));
+        }
+    }
+
+    TEST_CASE("Transform normals stay perpendicular to transformed tangents", Tags)
+    {
+        Transform transform = ExampleTransform();
+        Vector3 normal{0.0f, 0.0f, 1.0f};
+        Vector3 tangents[2] = {{1.0f, 0.0f, 0.0f}, {0.3f, 0.7f, 0.0f}};
+
+        Vector3 transformedNormal = transform.TransformNormal(normal);
+        for (const Vector3& tangent : tangents)
+        {
+            REQUIRE_THAT(transformedNormal.Dot(transform.TransformVector(tangent)),
+                         Catch::Matchers::WithinAbs(0.0f, 1e-4f));
+        }
+    }
+
+    TEST_CASE("Transform inverse of a singular transform is the identity", Tags)
+    {
+        Transform singular = Transform::Scaling({1.0f, 0.0f, 1.0f});
+        REQUIRE(singular.Inverse().ToMatrix() == Matrix::Identity());
+    }
+}
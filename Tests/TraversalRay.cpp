@@ -0,0 +1,39 @@
+#include "RayTracer/TraversalRay.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[TraversalRay]";
+
+    TEST_CASE("TraversalRay caches the inverse direction and signs", Tags)
+    {
+        TraversalRay ray{Ray{{1.0f, 2.0f, 3.0f}, {-0.5f, 0.25f, 0.0f}, UnitDirection}};
+
+        REQUIRE(ray.inverseDirection.x == -2.0f);
+        REQUIRE(ray.inverseDirection.y == 4.0f);
+        REQUIRE(ray.inverseDirection.z == std::numeric_limits<float>::infinity());
+        REQUIRE(ray.sign[0] == 1);
+        REQUIRE(ray.sign[1] == 0);
+        REQUIRE(ray.sign[2] == 0);
+    }
+
+    TEST_CASE("TraversalRay sign follows the sign bit of zero components", Tags)
+    {
+        TraversalRay ray{Ray{{0.0f, 0.0f, 0.0f}, {0.0f, -0.0f, 1.0f}, UnitDirection}};
+
+        REQUIRE(ray.sign[0] == 0);
+        REQUIRE(ray.sign[1] == 1);
+        REQUIRE(ray.inverseDirection.y == -std::numeric_limits<float>::infinity());
+    }
+
+    TEST_CASE("TraversalRay interval defaults to the whole positive ray", Tags)
+    {
+        TraversalRay ray{Ray{}};
+
+        REQUIRE(ray.tMin == 0.0f);
+        REQUIRE(ray.tMax == std::numeric_limits<float>::infinity());
+    }
+}
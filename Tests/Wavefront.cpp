@@ -0,0 +1,359 @@
+#include "RayTracer/Bvh.hpp"
+#include "RayTracer/Wavefront.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[Wavefront]";
+
+    namespace
+    {
+        constexpr int Size = 48;
+
+        Color Sky(const WavefrontIntegrator::Settings& settings, const Vector3& direction)
+        {
+            float blend = 0.5f * (direction.y + 1.0f);
+            return (1.0f - blend) * settings.skyHorizon + blend * settings.skyZenith;
+        }
+
+        void RequireNear(const Color& actual, const Color& expected, float tolerance)
+        {
+            REQUIRE_THAT(actual.r, Catch::Matchers::WithinAbs(expected.r, tolerance));
+            REQUIRE_THAT(actual.g, Catch::Matchers::WithinAbs(expected.g, tolerance));
+            REQUIRE_THAT(actual.b, Catch::Matchers::WithinAbs(expected.b, tolerance));
+        }
+
+        Framebuffer Render(const WavefrontIntegrator& integrator, const Bvh& bvh)
+        {
+            Arena arena;
+            Framebuffer framebuffer{Size, Size};
+            integrator.RenderTile(bvh, Tile{0, 0, Size, Size}, arena, framebuffer);
+            return framebuffer;
+        }
+    }
+
+    TEST_CASE("Wavefront rays that escape see the sky", Tags)
+    {
+        Camera camera{{0.0f, 0.0f, 0.0f}, {0.0f, 0.3f, -1.0f}, {0.0f, 1.0f, 0.0f}, 1.2f, Size, Size};
+        WavefrontIntegrator::Settings settings;
+        WavefrontIntegrator integrator{camera, settings};
+        Framebuffer framebuffer = Render(integrator, Bvh{std::span<const Sphere>{}});
+
+        for (int y = 0; y < Size; y += 5)
+        {
+            for (int x = 0; x < Size; x += 5)
+            {
+                Ray ray = camera.GenerateRay(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                RequireNear(framebuffer.At(x, y), Sky(settings, ray.direction), 1e-5f);
+            }
+        }
+    }
+
+    TEST_CASE("Wavefront direct sunlight is blocked by occluders", Tags)
+    {
+        // Looking straight down at the ground with the sun straight up, so a sphere above the ground casts its
+        // shadow directly below it.
+        Camera camera{{0.0f, 10.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, 1.2f, Size, Size};
+        std::vector<Sphere> spheres = {{{0.0f, -1000.0f, 0.0f}, 1000.0f}, {{3.0f, 5.0f, 0.0f}, 1.0f}};
+        Bvh bvh{spheres};
+
+        WavefrontIntegrator::Settings settings;
+        settings.samplesPerPixel = 1;
+        settings.maxDepth = 1;
+        settings.materials = {Material::Lambert({0.5f, 0.5f, 0.5f})};
+        settings.skyHorizon = {0.0f, 0.0f, 0.0f};
+        settings.skyZenith = {0.0f, 0.0f, 0.0f};
+        settings.lights = {Light::Directional({0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f})};
+        WavefrontIntegrator integrator{camera, settings};
+        Framebuffer framebuffer = Render(integrator, bvh);
+
+        // The pixel whose ray meets the ground closest to the given point.
+        auto pixelAt = [&](float groundX) {
+            int best[2] = {0, 0};
+            float bestDistance = std::numeric_limits<float>::infinity();
+            for (int y = 0; y < Size; ++y)
+            {
+                for (int x = 0; x < Size; ++x)
+                {
+                    Ray ray = camera.GenerateRay(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                    Vector3 ground = ray.At(-ray.origin.y / ray.direction.y);
+                    float distance = (ground - Vector3{groundX, 0.0f, 0.0f}).Length();
+                    if (distance < bestDistance)
+                    {
+                        bestDistance = distance;
+                        best[0] = x;
+                        best[1] = y;
+                    }
+                }
+            }
+            return framebuffer.At(best[0], best[1]);
+        };
+
+        const float lit = 0.5f * std::numbers::inv_pi_v<float>;
+        RequireNear(pixelAt(-3.0f), {lit, lit, lit}, 1e-3f);
+        RequireNear(pixelAt(3.0f), {0.0f, 0.0f, 0.0f}, 1e-6f);
+    }
+
+    TEST_CASE("Wavefront generates paths in the configured pixel order", Tags)
+    {
+        Camera camera{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}, 1.0f, 16, 16};
+        const Tile tile{3, 2, 11, 7};
+        for (PixelOrder order : {PixelOrder::Scanline, PixelOrder::Morton})
+        {
+            WavefrontIntegrator::Settings settings;
+            settings.pixelOrder = order;
+            WavefrontIntegrator integrator{camera, settings};
+            Arena arena;
+            PathQueue paths{77, &arena};
+            integrator.Generate(tile, 0, paths);
+
+            REQUIRE(paths.size == 77);
+            std::size_t i = 0;
+            ForEachPixel(tile, order, [&](int x, int y) {
+                REQUIRE(paths.pixel[i] == static_cast<std::uint32_t>((y - tile.y) * tile.width + (x - tile.x)));
+                Ray ray = camera.GenerateRay(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                REQUIRE_THAT(paths.directionX[i], Catch::Matchers::WithinAbs(ray.direction.x, 1e-5f));
+                REQUIRE_THAT(paths.directionY[i], Catch::Matchers::WithinAbs(ray.direction.y, 1e-5f));
+                REQUIRE(paths.originZ[i] == 0.0f);
+                ++i;
+            });
+        }
+    }
+
+    TEST_CASE("Wavefront shading compacts surviving paths in order", Tags)
+    {
+        Camera camera{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}, 1.0f, 4, 1};
+        WavefrontIntegrator::Settings settings;
+        settings.rouletteDepth = 100;
+        WavefrontIntegrator integrator{camera, settings};
+
+        Arena arena;
+        PathQueue paths{4, &arena};
+        PathQueue next{4, &arena};
+        HitQueue hits{4, &arena};
+        SurfaceQueue surfaces{4, &arena};
+        ShadowQueue shadows{4, &arena};
+        Accumulator accumulator{4, &arena};
+        integrator.Generate(Tile{0, 0, 4, 1}, 0, paths);
+
+        // Paths 0 and 2 escape, 1 and 3 hit a surface facing them.
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            hits.t[i] = i % 2 == 0 ? std::numeric_limits<float>::infinity() : 2.0f;
+            hits.normalX[i] = 0.0f;
+            hits.normalY[i] = 0.0f;
+            hits.normalZ[i] = 1.0f;
+            hits.material[i] = 0;
+        }
+        integrator.Shade(paths, hits, 0, surfaces, next, shadows, accumulator);
+
+        REQUIRE(next.size == 2);
+        REQUIRE(next.pixel[0] == 1);
+        REQUIRE(next.pixel[1] == 3);
+        REQUIRE(next.throughputR[0] == settings.materials[0].diffuse.r);
+        REQUIRE(next.directionZ[0] > 0.0f);
+        REQUIRE(accumulator.r[0] > 0.0f);
+        REQUIRE(accumulator.r[1] == 0.0f);
+    }
+
+    TEST_CASE("Wavefront rendering is deterministic", Tags)
+    {
+        Camera camera{{0.0f, 1.0f, 6.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, 1.0f, Size, Size};
+        std::vector<Sphere> spheres = {{{0.0f, -1000.0f, 0.0f}, 999.0f}, {{0.0f, 0.0f, 0.0f}, 1.0f}};
+        Bvh bvh{spheres};
+        WavefrontIntegrator::Settings settings;
+        settings.lights = {Light::Directional({1.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f})};
+        WavefrontIntegrator integrator{camera, settings};
+
+        Framebuffer first = Render(integrator, bvh);
+        Framebuffer second = Render(integrator, bvh);
+        for (int y = 0; y < Size; ++y)
+        {
+            for (int x = 0; x < Size; ++x)
+            {
+                REQUIRE(first.At(x, y) == second.At(x, y));
+            }
+        }
+    }
+
+    TEST_CASE("Wavefront sorting reorders paths by key", Tags)
+    {
+        Camera camera{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}, 1.0f, 16, 16};
+        // Scanline order makes the pixel of every path its index, which the checks below rely on.
+        WavefrontIntegrator::Settings settings;
+        settings.pixelOrder = PixelOrder::Scanline;
+        WavefrontIntegrator integrator{camera, settings};
+
+        Arena arena;
+        PathQueue paths{256, &arena};
+        PathQueue sorted{256, &arena};
+        SortQueue sortQueue{256, &arena};
+        integrator.Generate(Tile{0, 0, 16, 16}, 0, paths);
+        // Spread the origins so that the keys differ in both octant and position.
+        for (std::size_t i = 0; i < paths.size; ++i)
+        {
+            paths.originX[i] = static_cast<float>((i * 37) % 101);
+            paths.originZ[i] = static_cast<float>((i * 11) % 13);
+        }
+        paths.size = 200;
+        WavefrontIntegrator::Sort(paths, sortQueue, sorted);
+
+        REQUIRE(sorted.size == paths.size);
+        Aabb bounds;
+        for (std::size_t i = 0; i < paths.size; ++i)
+        {
+            bounds.Expand(Vector3{paths.originX[i], paths.originY[i], paths.originZ[i]});
+        }
+        RaySortKey key{bounds};
+        std::vector<bool> seen(paths.size, false);
+        std::uint32_t previous = 0;
+        for (std::size_t i = 0; i < sorted.size; ++i)
+        {
+            std::uint32_t current = key({sorted.originX[i], sorted.originY[i], sorted.originZ[i]},
+                                        {sorted.directionX[i], sorted.directionY[i], sorted.directionZ[i]});
+            REQUIRE(current >= previous);
+            previous = current;
+
+            // Every path moves as a whole.
+            std::uint32_t pixel = sorted.pixel[i];
+            REQUIRE(pixel < paths.size);
+            REQUIRE_FALSE(seen[pixel]);
+            seen[pixel] = true;
+            REQUIRE(sorted.originX[i] == paths.originX[pixel]);
+            REQUIRE(sorted.directionY[i] == paths.directionY[pixel]);
+            REQUIRE(sorted.random[i] == paths.random[pixel]);
+        }
+    }
+
+    TEST_CASE("Wavefront sorting does not change the image", Tags)
+    {
+        Camera camera{{0.0f, 1.0f, 6.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, 1.0f, Size, Size};
+        std::vector<Sphere> spheres = {{{0.0f, -1000.0f, 0.0f}, 999.0f},
+                                       {{0.0f, 0.0f, 0.0f}, 1.0f},
+                                       {{2.0f, -0.5f, 1.0f}, 0.5f}};
+        Bvh bvh{spheres};
+        WavefrontIntegrator::Settings settings;
+        settings.samplesPerPixel = 2;
+        settings.lights = {Light::Directional({1.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f})};
+        Framebuffer unsorted = Render(WavefrontIntegrator{camera, settings}, bvh);
+        settings.sortRays = true;
+        Framebuffer sorted = Render(WavefrontIntegrator{camera, settings}, bvh);
+
+        // Every pixel receives its contributions in the same order, so the results are identical.
+        int mismatches = 0;
+        for (int y = 0; y < Size; ++y)
+        {
+            for (int x = 0; x < Size; ++x)
+            {
+                mismatches += unsorted.At(x, y) == sorted.At(x, y) ? 0 : 1;
+            }
+        }
+        REQUIRE(mismatches == 0);
+    }
+
+    TEST_CASE("Wavefront point lights are shadowed only up to the light", Tags)
+    {
+        // A point light above the ground with an occluder above the light and another between light and ground.
+        Camera camera{{0.0f, 10.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, 1.2f, Size, Size};
+        std::vector<Sphere> spheres = {{{0.0f, -1000.0f, 0.0f}, 1000.0f},
+                                       {{-3.0f, 6.0f, 0.0f}, 1.0f},
+                                       {{1.0f, 2.0f, 0.0f}, 0.5f}};
+        Bvh bvh{spheres};
+
+        WavefrontIntegrator::Settings settings;
+        settings.samplesPerPixel = 1;
+        settings.maxDepth = 1;
+        settings.skyHorizon = {0.0f, 0.0f, 0.0f};
+        settings.skyZenith = {0.0f, 0.0f, 0.0f};
+        settings.materials = {Material::Lambert({0.5f, 0.5f, 0.5f}), Material::Lambert({1.0f, 0.0f, 0.0f})};
+        settings.materialIds = {0, 1, 1};
+        settings.lights = {Light::Point({-3.0f, 4.0f, 0.0f}, {16.0f, 16.0f, 16.0f})};
+        WavefrontIntegrator integrator{camera, settings};
+        Framebuffer framebuffer = Render(integrator, bvh);
+
+        auto groundPixel = [&](float groundX) {
+            Color best;
+            float bestDistance = std::numeric_limits<float>::infinity();
+            for (int y = 0; y < Size; ++y)
+            {
+                for (int x = 0; x < Size; ++x)
+                {
+                    Ray ray = camera.GenerateRay(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                    Vector3 ground = ray.At(-ray.origin.y / ray.direction.y);
+                    float distance = (ground - Vector3{groundX, 0.0f, 0.0f}).Length();
+                    if (distance < bestDistance)
+                    {
+                        bestDistance = distance;
+                        best = framebuffer.At(x, y);
+                    }
+                }
+            }
+            return best;
+        };
+
+        // The pixel nearest to the ground point at x = -3 is slightly off it, which the tolerance absorbs.
+        const float below = 0.5f * std::numbers::inv_pi_v<float> * 16.0f / 16.0f;
+        Color underLight = groundPixel(-3.0f);
+        REQUIRE_THAT(underLight.r, Catch::Matchers::WithinRel(below, 0.05f));
+        REQUIRE(underLight.r == underLight.g);
+
+        // The light at (-3, 4) casts the shadow of the small sphere at (1, 2) onto x = 5.
+        REQUIRE(groundPixel(5.0f) == Color{0.0f, 0.0f, 0.0f});
+
+        // The small sphere uses the red material.
+        float red = 0.0f;
+        for (int y = 0; y < Size; ++y)
+        {
+            for (int x = 0; x < Size; ++x)
+            {
+                Ray ray = camera.GenerateRay(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                Hit hit = bvh.ClosestHit(ray);
+                if (hit.hit && hit.primitive == 2)
+                {
+                    REQUIRE(framebuffer.At(x, y).g == 0.0f);
+                    red = std::max(red, framebuffer.At(x, y).r);
+                }
+            }
+        }
+        REQUIRE(red > 0.0f);
+    }
+
+    TEST_CASE("Wavefront falls back to material 0 for invalid material IDs", Tags)
+    {
+        Camera camera{{0.0f, 10.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, 1.2f, Size, Size};
+        std::vector<Sphere> spheres = {{{0.0f, -1000.0f, 0.0f}, 1000.0f}, {{1.0f, 2.0f, 0.0f}, 0.5f}};
+        Bvh bvh{spheres};
+
+        WavefrontIntegrator::Settings settings;
+        settings.samplesPerPixel = 1;
+        settings.lights = {Light::Point({-3.0f, 4.0f, 0.0f}, {16.0f, 16.0f, 16.0f})};
+        settings.materials = {Material::Lambert({0.5f, 0.5f, 0.5f}), Material::Lambert({1.0f, 0.0f, 0.0f})};
+        Framebuffer expected = Render(WavefrontIntegrator{camera, settings}, bvh);
+
+        settings.materialIds = {2, 100};
+        Framebuffer clamped = Render(WavefrontIntegrator{camera, settings}, bvh);
+
+        // Without materials the default takes their place.
+        settings.materials.clear();
+        Framebuffer empty = Render(WavefrontIntegrator{camera, settings}, bvh);
+        settings.materials = WavefrontIntegrator::Settings{}.materials;
+        settings.materialIds.clear();
+        Framebuffer defaults = Render(WavefrontIntegrator{camera, settings}, bvh);
+
+        for (int y = 0; y < Size; ++y)
+        {
+            for (int x = 0; x < Size; ++x)
+            {
+                REQUIRE(clamped.At(x, y) == expected.At(x, y));
+                REQUIRE(empty.At(x, y) == defaults.At(x, y));
+            }
+        }
+    }
+}
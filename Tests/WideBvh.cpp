@@ -0,0 +1,138 @@
+#include "RayTracer/Accelerator.hpp"
+#include "RayTracer/WideBvh.hpp"
+
+#include "RandomSpheres.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+#include <vector>
+
+namespace RayTracer::Tests
+{
+    constexpr const char* Tags = "[WideBvh]";
+
+    static_assert(Accelerator<Bvh4>);
+    static_assert(Accelerator<Bvh8>);
+
+    namespace
+    {
+        template <int Width>
+        void RequireSameHits(const std::vector<Sphere>& spheres, std::mt19937& rng)
+        {
+            Bvh bvh{spheres};
+            WideBvh<Width> wide{bvh};
+            std::uniform_real_distribution<float> position{-20.0f, 20.0f};
+
+            for (int i = 0; i < 200; ++i)
+            {
+                Ray ray{{position(rng), position(rng), position(rng)}, {position(rng), position(rng), position(rng)}};
+                Hit expected = bvh.ClosestHit(ray);
+                Hit hit = wide.ClosestHit(ray);
+
+                REQUIRE(hit.hit == expected.hit);
+                if (expected.hit)
+                {
+                    REQUIRE(hit.primitive == expected.primitive);
+                    REQUIRE(hit.t == expected.t);
+                }
+            }
+        }
+    }
+
+    TEST_CASE("WideBvh over no spheres never hits", Tags)
+    {
+        Bvh bvh{std::span<const Sphere>{}};
+        Bvh4 wide{bvh};
+
+        REQUIRE_FALSE(wide.ClosestHit(Ray{{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}).hit);
+    }
+
+    TEST_CASE("WideBvh over a single sphere", Tags)
+    {
+        Sphere sphere{{0.0f, 0.0f, 0.0f}, 1.0f};
+        Bvh bvh{std::span<const Sphere>{&sphere, 1}};
+        Bvh8 wide{bvh};
+
+        Hit hit = wide.ClosestHit(Ray{{0.0f, 0.0f, -5.0f}, {0.0f, 0.0f, 1.0f}});
+        REQUIRE(hit.hit);
+        REQUIRE(hit.t == 4.0f);
+    }
+
+    TEST_CASE("WideBvh collapses to fewer nodes than the binary tree", Tags)
+    {
+        std::mt19937 rng{7};
+        std::vector<Sphere> spheres = RandomSpheres(rng, 1000);
+        Bvh bvh{spheres};
+        Bvh4 wide4{bvh};
+        Bvh8 wide8{bvh};
+
+        REQUIRE(wide4.Nodes().size() < bvh.Nodes().size() / 2);
+        REQUIRE(wide8.Nodes().size() < wide4.Nodes().size());
+    }
+
+    TEST_CASE("Bvh4 closest hit matches binary Bvh", Tags)
+    {
+        std::mt19937 rng{11};
+        RequireSameHits<4>(RandomSpheres(rng, 1000), rng);
+    }
+
+    TEST_CASE("Bvh8 closest hit matches binary Bvh", Tags)
+    {
+        std::mt19937 rng{13};
+        RequireSameHits<8>(RandomSpheres(rng, 1000), rng);
+    }
+
+    TEST_CASE("Bvh8 only reports hits inside the ray interval", Tags)
+    {
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 10; ++i)
+        {
+            spheres.push_back({{static_cast<float>(i), 0.0f, 0.0f}, 0.25f});
+        }
+        Bvh8 accelerator{Bvh{spheres}};
+        Ray ray{{-5.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, UnitDirection};
+
+        // Sphere 2 spans t = 6.75 to 7.25, so starting at t = 7 hits its far side.
+        Hit hit = accelerator.ClosestHit(TraversalRay{ray, 7.0f});
+        REQUIRE(hit.hit);
+        REQUIRE(hit.primitive == 2);
+        REQUIRE(hit.t == 7.25f);
+
+        REQUIRE_FALSE(accelerator.ClosestHit(TraversalRay{ray, 7.3f, 7.7f}).hit);
+        REQUIRE(accelerator.ClosestHit(TraversalRay{ray, 0.0f, 5.0f}).primitive == 0);
+    }
+
+    TEST_CASE("Bvh4 occlusion matches brute force", Tags)
+    {
+        std::mt19937 rng{7};
+        std::uniform_real_distribution<float> position{-20.0f, 20.0f};
+        std::uniform_real_distribution<float> size{0.1f, 1.5f};
+        std::uniform_real_distribution<float> distance{0.0f, 30.0f};
+
+        std::vector<Sphere> spheres;
+        for (int i = 0; i < 500; ++i)
+        {
+            spheres.push_back({{position(rng), position(rng), position(rng)}, size(rng)});
+        }
+        Bvh4 accelerator{Bvh{spheres}};
+
+        int occludedCount = 0;
+        for (int i = 0; i < 300; ++i)
+        {
+            Ray ray{{position(rng), position(rng), position(rng)}, {position(rng), position(rng), position(rng)}};
+            float tMax = distance(rng);
+
+            bool expected = false;
+            for (const Sphere& sphere : spheres)
+            {
+                expected = expected || sphere.Occluded(ray, tMax);
+            }
+
+            REQUIRE(accelerator.Occluded(ray, tMax) == expected);
+            occludedCount += expected ? 1 : 0;
+        }
+        REQUIRE(occludedCount > 0);
+        REQUIRE(occludedCount < 300);
+    }
+}
@@ -0,0 +1,7 @@
+@echo off
+
+cd %~dp0
+
+cmake -S . -B Build
+cmake --build Build --config Release --target RayTracer_Bench
+Build\Benchmarks\Release\RayTracer_Bench.exe %*
@@ -0,0 +1,7 @@
+#!/bin/bash
+
+cd "$(dirname "$0")"
+
+cmake -S . -B Build
+cmake --build Build --config Release --target RayTracer_Bench
+Build/Benchmarks/RayTracer_Bench "$@"